@@ -0,0 +1,194 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "OpenVRCameraFeed.h"
+#include "Engine/Engine.h"
+#include "IXRTrackingSystem.h"
+#include "RenderingThread.h"
+#include "TextureResource.h"
+
+UOpenVRCameraFeed::UOpenVRCameraFeed(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	CameraTexture = nullptr;
+	FrameType = EOpenVRCameraFrameType::VRFrameType_Distorted;
+	LastFrameSequence = -1;
+	FrameWidth = 0;
+	FrameHeight = 0;
+	FrameBufferSize = 0;
+}
+
+void UOpenVRCameraFeed::BeginDestroy()
+{
+	Super::BeginDestroy();
+
+	// Any pending uploads hold their own reference to the staging ring, we only need to wait on them before our texture goes away
+	Staging.Reset();
+	ReleaseFence.BeginFence();
+}
+
+bool UOpenVRCameraFeed::IsReadyForFinishDestroy()
+{
+	return Super::IsReadyForFinishDestroy() && ReleaseFence.IsFenceComplete();
+}
+
+UOpenVRCameraFeed * UOpenVRCameraFeed::CreateOpenVRCameraFeed(UObject* WorldContextObject, UPARAM(ref) FBPOpenVRCameraHandle & CameraHandle, EOpenVRCameraFrameType FrameType, EBPOVRResultSwitch & Result)
+{
+#if !STEAMVR_SUPPORTED_PLATFORM
+	Result = EBPOVRResultSwitch::OnFailed;
+	return nullptr;
+#else
+
+	if (!CameraHandle.IsValid() || !FApp::CanEverRender())
+	{
+		Result = EBPOVRResultSwitch::OnFailed;
+		return nullptr;
+	}
+
+	UOpenVRCameraFeed * NewFeed = NewObject<UOpenVRCameraFeed>(WorldContextObject ? WorldContextObject : (UObject*)GetTransientPackage());
+	NewFeed->CameraHandle = CameraHandle;
+	NewFeed->FrameType = FrameType;
+
+	if (!NewFeed->InitializeFeed())
+	{
+		Result = EBPOVRResultSwitch::OnFailed;
+		return nullptr;
+	}
+
+	Result = EBPOVRResultSwitch::OnSucceeded;
+	return NewFeed;
+#endif
+}
+
+bool UOpenVRCameraFeed::InitializeFeed()
+{
+#if !STEAMVR_SUPPORTED_PLATFORM
+	return false;
+#else
+
+	// Don't run anything if no HMD and if the HMD is not a steam type
+	if (!GEngine->XRSystem.IsValid() || (GEngine->XRSystem->GetSystemName() != SteamVRSystemName))
+		return false;
+
+	vr::HmdError HmdErr;
+	vr::IVRTrackedCamera * VRCamera = (vr::IVRTrackedCamera*)vr::VR_GetGenericInterface(vr::IVRTrackedCamera_Version, &HmdErr);
+
+	if (!VRCamera || HmdErr != vr::HmdError::VRInitError_None)
+		return false;
+
+	vr::EVRTrackedCameraError CamError = VRCamera->GetCameraFrameSize(vr::k_unTrackedDeviceIndex_Hmd, (vr::EVRTrackedCameraFrameType)FrameType, &FrameWidth, &FrameHeight, &FrameBufferSize);
+
+	if (CamError != vr::EVRTrackedCameraError::VRTrackedCameraError_None || FrameWidth <= 0 || FrameHeight <= 0)
+		return false;
+
+	// Make sure formats are correct
+	check(FrameBufferSize == (FrameWidth * FrameHeight * GPixelFormats[EPixelFormat::PF_R8G8B8A8].BlockBytes));
+
+	CameraTexture = UTexture2D::CreateTransient(FrameWidth, FrameHeight, EPixelFormat::PF_R8G8B8A8);
+
+	if (!CameraTexture)
+		return false;
+
+	CameraTexture->PlatformData->NumSlices = 1;
+	CameraTexture->NeverStream = true;
+	CameraTexture->UpdateResource();
+
+	Staging = MakeShareable(new FOpenVRCameraFeedStaging());
+	Staging->Allocate(FrameBufferSize);
+	LastFrameSequence = -1;
+
+	return true;
+#endif
+}
+
+void UOpenVRCameraFeed::UpdateCameraFeed(bool & bNewFrame, EBPOVRResultSwitch & Result)
+{
+	bNewFrame = false;
+
+#if !STEAMVR_SUPPORTED_PLATFORM
+	Result = EBPOVRResultSwitch::OnFailed;
+	return;
+#else
+
+	// Don't run anything if no HMD and if the HMD is not a steam type
+	if (!GEngine->XRSystem.IsValid() || (GEngine->XRSystem->GetSystemName() != SteamVRSystemName))
+	{
+		Result = EBPOVRResultSwitch::OnFailed;
+		return;
+	}
+
+	if (!CameraTexture || !Staging.IsValid() || !CameraHandle.IsValid())
+	{
+		Result = EBPOVRResultSwitch::OnFailed;
+		return;
+	}
+
+	vr::HmdError HmdErr;
+	vr::IVRTrackedCamera * VRCamera = (vr::IVRTrackedCamera*)vr::VR_GetGenericInterface(vr::IVRTrackedCamera_Version, &HmdErr);
+
+	if (!VRCamera || HmdErr != vr::HmdError::VRInitError_None)
+	{
+		Result = EBPOVRResultSwitch::OnFailed;
+		return;
+	}
+
+	// Request only the header first, this lets us skip the copy entirely if the camera hasn't advanced
+	vr::CameraVideoStreamFrameHeader_t CamHeader;
+	vr::EVRTrackedCameraError CamError = VRCamera->GetVideoStreamFrameBuffer(CameraHandle.pCameraHandle, (vr::EVRTrackedCameraFrameType)FrameType, nullptr, 0, &CamHeader, sizeof(vr::CameraVideoStreamFrameHeader_t));
+
+	// No frame available = still on spin / wake up
+	if (CamError != vr::EVRTrackedCameraError::VRTrackedCameraError_None)
+	{
+		Result = EBPOVRResultSwitch::OnFailed;
+		return;
+	}
+
+	if (LastFrameSequence >= 0 && (uint32)LastFrameSequence == CamHeader.nFrameSequence)
+	{
+		// Still the same frame, texture already holds it
+		Result = EBPOVRResultSwitch::OnSucceeded;
+		return;
+	}
+
+	int32 Slot = Staging->AcquireBuffer();
+
+	if (Slot == INDEX_NONE)
+	{
+		// Render thread is behind, drop this frame rather than allocate or stall
+		Result = EBPOVRResultSwitch::OnSucceeded;
+		return;
+	}
+
+	TArray<uint8> & StagingBuffer = Staging->Buffers[Slot];
+	CamError = VRCamera->GetVideoStreamFrameBuffer(CameraHandle.pCameraHandle, (vr::EVRTrackedCameraFrameType)FrameType, StagingBuffer.GetData(), FrameBufferSize, &CamHeader, sizeof(vr::CameraVideoStreamFrameHeader_t));
+
+	if (CamError != vr::EVRTrackedCameraError::VRTrackedCameraError_None)
+	{
+		Result = EBPOVRResultSwitch::OnFailed;
+		return;
+	}
+
+	LastFrameSequence = (int32)CamHeader.nFrameSequence;
+	Staging->InFlight[Slot].Increment();
+
+	TSharedPtr<FOpenVRCameraFeedStaging, ESPMode::ThreadSafe> StagingRef = Staging;
+	FTexture2DResource * TextureResource = (FTexture2DResource*)CameraTexture->Resource;
+	uint32 Width = FrameWidth;
+	uint32 Height = FrameHeight;
+
+	ENQUEUE_RENDER_COMMAND(UpdateOpenVRCameraFeedCode)(
+		[StagingRef, Slot, TextureResource, Width, Height](FRHICommandListImmediate& RHICmdList)
+	{
+		if (TextureResource && TextureResource->GetTexture2DRHI())
+		{
+			FUpdateTextureRegion2D Region(0, 0, 0, 0, Width, Height);
+			RHIUpdateTexture2D(TextureResource->GetTexture2DRHI(), 0, Region, Width * GPixelFormats[EPixelFormat::PF_R8G8B8A8].BlockBytes, StagingRef->Buffers[Slot].GetData());
+		}
+
+		StagingRef->InFlight[Slot].Decrement();
+	});
+
+	bNewFrame = true;
+	Result = EBPOVRResultSwitch::OnSucceeded;
+	return;
+#endif
+}
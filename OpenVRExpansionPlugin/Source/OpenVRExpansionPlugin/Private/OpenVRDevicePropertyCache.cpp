@@ -0,0 +1,223 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "OpenVRDevicePropertyCache.h"
+#include "HAL/IConsoleManager.h"
+
+namespace OpenVRDevicePropertyCacheCvars
+{
+	static float DevicePropertyCacheInterval = 1.0f;
+	FAutoConsoleVariableRef CVarDevicePropertyCacheInterval(
+		TEXT("vr.OpenVRDevicePropertyCacheInterval"),
+		DevicePropertyCacheInterval,
+		TEXT("Seconds that a tracked device property snapshot is re-used before being re-queried from OpenVR.\n")
+		TEXT("0: Always query the runtime"),
+		ECVF_Default);
+}
+
+#if STEAMVR_SUPPORTED_PLATFORM
+
+namespace
+{
+	template<typename ValueType, typename FetchFunc>
+	bool GetCachedProperty(TMap<int32, FOpenVRDevicePropertySnapshot::TCachedValue<ValueType>> & CachedValues, vr::ETrackedDeviceProperty Property, ValueType & OutValue, FetchFunc Fetch)
+	{
+		if (FOpenVRDevicePropertySnapshot::TCachedValue<ValueType> * CachedValue = CachedValues.Find((int32)Property))
+		{
+			if (CachedValue->bSucceeded)
+				OutValue = CachedValue->Value;
+
+			return CachedValue->bSucceeded;
+		}
+
+		FOpenVRDevicePropertySnapshot::TCachedValue<ValueType> & NewValue = CachedValues.Add((int32)Property);
+		NewValue.bSucceeded = Fetch(NewValue.Value);
+
+		if (NewValue.bSucceeded)
+			OutValue = NewValue.Value;
+
+		return NewValue.bSucceeded;
+	}
+}
+
+FOpenVRDevicePropertyCache & FOpenVRDevicePropertyCache::Get()
+{
+	check(IsInGameThread());
+	static FOpenVRDevicePropertyCache DevicePropertyCache;
+	return DevicePropertyCache;
+}
+
+vr::ETrackedDeviceProperty FOpenVRDevicePropertyCache::GetPropertyEnum(const TCHAR * EnumName, uint8 Value)
+{
+	TArray<vr::ETrackedDeviceProperty> * Lookup = PropertyEnumLookup.Find(EnumName);
+
+	if (!Lookup)
+	{
+		Lookup = &PropertyEnumLookup.Add(EnumName);
+
+		if (const UEnum* EnumPtr = FindObject<UEnum>(ANY_PACKAGE, EnumName, true))
+		{
+			// Skipping the _MAX entry
+			for (int32 i = 0; i < EnumPtr->NumEnums() - 1; ++i)
+			{
+				Lookup->Add(VREnumToString(EnumName, (uint8)i));
+			}
+		}
+	}
+
+	return Lookup->IsValidIndex(Value) ? (*Lookup)[Value] : vr::ETrackedDeviceProperty::Prop_Invalid;
+}
+
+bool FOpenVRDevicePropertyCache::IsDeviceConnected(vr::IVRSystem * VRSystem, int32 DeviceID, vr::ETrackedDeviceClass & OutDeviceClass)
+{
+	FOpenVRDevicePropertySnapshot * Snapshot = GetValidatedSnapshot(VRSystem, DeviceID);
+
+	if (!Snapshot)
+	{
+		OutDeviceClass = vr::ETrackedDeviceClass::TrackedDeviceClass_Invalid;
+		return false;
+	}
+
+	OutDeviceClass = Snapshot->DeviceClass;
+	return Snapshot->bConnected;
+}
+
+void FOpenVRDevicePropertyCache::InvalidateDevice(int32 DeviceID)
+{
+	if (DeviceID == INDEX_NONE)
+	{
+		for (FOpenVRDevicePropertySnapshot & Snapshot : Devices)
+		{
+			Snapshot.Empty();
+			Snapshot.LastValidatedFrame = 0;
+		}
+	}
+	else if (DeviceID >= 0 && DeviceID < (int32)vr::k_unMaxTrackedDeviceCount)
+	{
+		Devices[DeviceID].Empty();
+		Devices[DeviceID].LastValidatedFrame = 0;
+	}
+}
+
+FOpenVRDevicePropertySnapshot * FOpenVRDevicePropertyCache::GetValidatedSnapshot(vr::IVRSystem * VRSystem, int32 DeviceID)
+{
+	if (!VRSystem || DeviceID < 0 || DeviceID >= (int32)vr::k_unMaxTrackedDeviceCount)
+		return nullptr;
+
+	FOpenVRDevicePropertySnapshot & Snapshot = Devices[DeviceID];
+
+	// Connection state and class are only checked once per frame no matter how many properties are requested
+	if (Snapshot.LastValidatedFrame == GFrameCounter && Snapshot.LastValidatedFrame != 0)
+		return &Snapshot;
+
+	Snapshot.LastValidatedFrame = GFrameCounter;
+
+	bool bConnected = VRSystem->IsTrackedDeviceConnected(DeviceID);
+	vr::ETrackedDeviceClass DeviceClass = VRSystem->GetTrackedDeviceClass(DeviceID);
+	double CurrentTime = FPlatformTime::Seconds();
+
+	// Device was activated, deactivated or swapped out for something else, or the snapshot is stale
+	if (bConnected != Snapshot.bConnected || DeviceClass != Snapshot.DeviceClass ||
+		OpenVRDevicePropertyCacheCvars::DevicePropertyCacheInterval <= 0.0f ||
+		(CurrentTime - Snapshot.LastRefreshTime) >= OpenVRDevicePropertyCacheCvars::DevicePropertyCacheInterval)
+	{
+		Snapshot.Empty();
+		Snapshot.bConnected = bConnected;
+		Snapshot.DeviceClass = DeviceClass;
+		Snapshot.LastRefreshTime = CurrentTime;
+	}
+
+	return &Snapshot;
+}
+
+bool FOpenVRDevicePropertyCache::GetStringProperty(vr::IVRSystem * VRSystem, int32 DeviceID, vr::ETrackedDeviceProperty Property, FString & OutValue)
+{
+	FOpenVRDevicePropertySnapshot * Snapshot = GetValidatedSnapshot(VRSystem, DeviceID);
+	if (!Snapshot)
+		return false;
+
+	return GetCachedProperty(Snapshot->StringValues, Property, OutValue, [&](FString & Value)
+	{
+		vr::TrackedPropertyError pError = vr::TrackedPropertyError::TrackedProp_Success;
+		char charvalue[vr::k_unMaxPropertyStringSize];
+		uint32_t buffersize = vr::k_unMaxPropertyStringSize;
+		VRSystem->GetStringTrackedDeviceProperty(DeviceID, Property, charvalue, buffersize, &pError);
+
+		if (pError != vr::TrackedPropertyError::TrackedProp_Success)
+			return false;
+
+		Value = FString(ANSI_TO_TCHAR(charvalue));
+		return true;
+	});
+}
+
+bool FOpenVRDevicePropertyCache::GetBoolProperty(vr::IVRSystem * VRSystem, int32 DeviceID, vr::ETrackedDeviceProperty Property, bool & OutValue)
+{
+	FOpenVRDevicePropertySnapshot * Snapshot = GetValidatedSnapshot(VRSystem, DeviceID);
+	if (!Snapshot)
+		return false;
+
+	return GetCachedProperty(Snapshot->BoolValues, Property, OutValue, [&](bool & Value)
+	{
+		vr::TrackedPropertyError pError = vr::TrackedPropertyError::TrackedProp_Success;
+		Value = VRSystem->GetBoolTrackedDeviceProperty(DeviceID, Property, &pError);
+		return pError == vr::TrackedPropertyError::TrackedProp_Success;
+	});
+}
+
+bool FOpenVRDevicePropertyCache::GetFloatProperty(vr::IVRSystem * VRSystem, int32 DeviceID, vr::ETrackedDeviceProperty Property, float & OutValue)
+{
+	FOpenVRDevicePropertySnapshot * Snapshot = GetValidatedSnapshot(VRSystem, DeviceID);
+	if (!Snapshot)
+		return false;
+
+	return GetCachedProperty(Snapshot->FloatValues, Property, OutValue, [&](float & Value)
+	{
+		vr::TrackedPropertyError pError = vr::TrackedPropertyError::TrackedProp_Success;
+		Value = VRSystem->GetFloatTrackedDeviceProperty(DeviceID, Property, &pError);
+		return pError == vr::TrackedPropertyError::TrackedProp_Success;
+	});
+}
+
+bool FOpenVRDevicePropertyCache::GetInt32Property(vr::IVRSystem * VRSystem, int32 DeviceID, vr::ETrackedDeviceProperty Property, int32 & OutValue)
+{
+	FOpenVRDevicePropertySnapshot * Snapshot = GetValidatedSnapshot(VRSystem, DeviceID);
+	if (!Snapshot)
+		return false;
+
+	return GetCachedProperty(Snapshot->Int32Values, Property, OutValue, [&](int32 & Value)
+	{
+		vr::TrackedPropertyError pError = vr::TrackedPropertyError::TrackedProp_Success;
+		Value = VRSystem->GetInt32TrackedDeviceProperty(DeviceID, Property, &pError);
+		return pError == vr::TrackedPropertyError::TrackedProp_Success;
+	});
+}
+
+bool FOpenVRDevicePropertyCache::GetUInt64Property(vr::IVRSystem * VRSystem, int32 DeviceID, vr::ETrackedDeviceProperty Property, uint64 & OutValue)
+{
+	FOpenVRDevicePropertySnapshot * Snapshot = GetValidatedSnapshot(VRSystem, DeviceID);
+	if (!Snapshot)
+		return false;
+
+	return GetCachedProperty(Snapshot->UInt64Values, Property, OutValue, [&](uint64 & Value)
+	{
+		vr::TrackedPropertyError pError = vr::TrackedPropertyError::TrackedProp_Success;
+		Value = VRSystem->GetUint64TrackedDeviceProperty(DeviceID, Property, &pError);
+		return pError == vr::TrackedPropertyError::TrackedProp_Success;
+	});
+}
+
+bool FOpenVRDevicePropertyCache::GetMatrix34Property(vr::IVRSystem * VRSystem, int32 DeviceID, vr::ETrackedDeviceProperty Property, vr::HmdMatrix34_t & OutValue)
+{
+	FOpenVRDevicePropertySnapshot * Snapshot = GetValidatedSnapshot(VRSystem, DeviceID);
+	if (!Snapshot)
+		return false;
+
+	return GetCachedProperty(Snapshot->Matrix34Values, Property, OutValue, [&](vr::HmdMatrix34_t & Value)
+	{
+		vr::TrackedPropertyError pError = vr::TrackedPropertyError::TrackedProp_Success;
+		Value = VRSystem->GetMatrix34TrackedDeviceProperty(DeviceID, Property, &pError);
+		return pError == vr::TrackedPropertyError::TrackedProp_Success;
+	});
+}
+
+#endif // STEAMVR_SUPPORTED_PLATFORM
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "IXRTrackingSystem.h"
 #include "IHeadMountedDisplay.h"
+#include "OpenVRRenderModelCache.h"
+#include "OpenVRDevicePropertyCache.h"
 
 #if WITH_EDITOR
 #include "Editor/UnrealEd/Classes/Editor/EditorEngine.h"
@@ -444,26 +446,19 @@ void UOpenVRExpansionFunctionLibrary::GetVRDevicePropertyString(EVRDevicePropert
 		return;
 	}
 
-	vr::TrackedPropertyError pError = vr::TrackedPropertyError::TrackedProp_Success;
-
-	vr::ETrackedDeviceProperty EnumPropertyValue = VREnumToString(TEXT("EVRDeviceProperty_String"), static_cast<uint8>(PropertyToRetrieve));
+	vr::ETrackedDeviceProperty EnumPropertyValue = FOpenVRDevicePropertyCache::Get().GetPropertyEnum(TEXT("EVRDeviceProperty_String"), static_cast<uint8>(PropertyToRetrieve));
 	if (EnumPropertyValue == vr::ETrackedDeviceProperty::Prop_Invalid)
 	{
 		Result = EBPOVRResultSwitch::OnFailed;
 		return;
 	}
 
-	char charvalue[vr::k_unMaxPropertyStringSize];
-	uint32_t buffersize = vr::k_unMaxPropertyStringSize;
-	uint32_t ret = VRSystem->GetStringTrackedDeviceProperty(DeviceID, EnumPropertyValue, charvalue, buffersize, &pError);
-
-	if (pError != vr::TrackedPropertyError::TrackedProp_Success)
+	if (!FOpenVRDevicePropertyCache::Get().GetStringProperty(VRSystem, DeviceID, EnumPropertyValue, StringValue))
 	{
 		Result = EBPOVRResultSwitch::OnFailed;
 		return;
 	}
 
-	StringValue = FString(ANSI_TO_TCHAR(charvalue));
 	Result = EBPOVRResultSwitch::OnSucceeded;
 	return;
 
@@ -492,24 +487,19 @@ void UOpenVRExpansionFunctionLibrary::GetVRDevicePropertyBool(EVRDeviceProperty_
 		return;
 	}
 
-	vr::TrackedPropertyError pError = vr::TrackedPropertyError::TrackedProp_Success;
-
-	vr::ETrackedDeviceProperty EnumPropertyValue = VREnumToString(TEXT("EVRDeviceProperty_Bool"), static_cast<uint8>(PropertyToRetrieve));
+	vr::ETrackedDeviceProperty EnumPropertyValue = FOpenVRDevicePropertyCache::Get().GetPropertyEnum(TEXT("EVRDeviceProperty_Bool"), static_cast<uint8>(PropertyToRetrieve));
 	if (EnumPropertyValue == vr::ETrackedDeviceProperty::Prop_Invalid)
 	{
 		Result = EBPOVRResultSwitch::OnFailed;
 		return;
 	}
 
-	bool ret = VRSystem->GetBoolTrackedDeviceProperty(DeviceID, EnumPropertyValue, &pError);
-
-	if (pError != vr::TrackedPropertyError::TrackedProp_Success)
+	if (!FOpenVRDevicePropertyCache::Get().GetBoolProperty(VRSystem, DeviceID, EnumPropertyValue, BoolValue))
 	{
 		Result = EBPOVRResultSwitch::OnFailed;
 		return;
 	}
 
-	BoolValue = ret;
 	Result = EBPOVRResultSwitch::OnSucceeded;
 	return;
 
@@ -538,24 +528,19 @@ void UOpenVRExpansionFunctionLibrary::GetVRDevicePropertyFloat(EVRDeviceProperty
 		return;
 	}
 
-	vr::TrackedPropertyError pError = vr::TrackedPropertyError::TrackedProp_Success;
-
-	vr::ETrackedDeviceProperty EnumPropertyValue = VREnumToString(TEXT("EVRDeviceProperty_Float"), static_cast<uint8>(PropertyToRetrieve));
+	vr::ETrackedDeviceProperty EnumPropertyValue = FOpenVRDevicePropertyCache::Get().GetPropertyEnum(TEXT("EVRDeviceProperty_Float"), static_cast<uint8>(PropertyToRetrieve));
 	if (EnumPropertyValue == vr::ETrackedDeviceProperty::Prop_Invalid)
 	{
 		Result = EBPOVRResultSwitch::OnFailed;
 		return;
 	}
 
-	float ret = VRSystem->GetFloatTrackedDeviceProperty(DeviceID, EnumPropertyValue, &pError);
-
-	if (pError != vr::TrackedPropertyError::TrackedProp_Success)
+	if (!FOpenVRDevicePropertyCache::Get().GetFloatProperty(VRSystem, DeviceID, EnumPropertyValue, FloatValue))
 	{
 		Result = EBPOVRResultSwitch::OnFailed;
 		return;
 	}
 
-	FloatValue = ret;
 	Result = EBPOVRResultSwitch::OnSucceeded;
 	return;
 
@@ -584,24 +569,19 @@ void UOpenVRExpansionFunctionLibrary::GetVRDevicePropertyInt32(EVRDeviceProperty
 		return;
 	}
 
-	vr::TrackedPropertyError pError = vr::TrackedPropertyError::TrackedProp_Success;
-
-	vr::ETrackedDeviceProperty EnumPropertyValue = VREnumToString(TEXT("EVRDeviceProperty_Int32"), static_cast<uint8>(PropertyToRetrieve));
+	vr::ETrackedDeviceProperty EnumPropertyValue = FOpenVRDevicePropertyCache::Get().GetPropertyEnum(TEXT("EVRDeviceProperty_Int32"), static_cast<uint8>(PropertyToRetrieve));
 	if (EnumPropertyValue == vr::ETrackedDeviceProperty::Prop_Invalid)
 	{
 		Result = EBPOVRResultSwitch::OnFailed;
 		return;
 	}
 
-	int32 ret = VRSystem->GetInt32TrackedDeviceProperty(DeviceID, EnumPropertyValue, &pError);
-
-	if (pError != vr::TrackedPropertyError::TrackedProp_Success)
+	if (!FOpenVRDevicePropertyCache::Get().GetInt32Property(VRSystem, DeviceID, EnumPropertyValue, IntValue))
 	{
 		Result = EBPOVRResultSwitch::OnFailed;
 		return;
 	}
 
-	IntValue = ret;
 	Result = EBPOVRResultSwitch::OnSucceeded;
 	return;
 
@@ -630,18 +610,15 @@ void UOpenVRExpansionFunctionLibrary::GetVRDevicePropertyUInt64(EVRDevicePropert
 		return;
 	}
 
-	vr::TrackedPropertyError pError = vr::TrackedPropertyError::TrackedProp_Success;
-
-	vr::ETrackedDeviceProperty EnumPropertyValue = VREnumToString(TEXT("EVRDeviceProperty_UInt64"), static_cast<uint8>(PropertyToRetrieve));
+	vr::ETrackedDeviceProperty EnumPropertyValue = FOpenVRDevicePropertyCache::Get().GetPropertyEnum(TEXT("EVRDeviceProperty_UInt64"), static_cast<uint8>(PropertyToRetrieve));
 	if (EnumPropertyValue == vr::ETrackedDeviceProperty::Prop_Invalid)
 	{
 		Result = EBPOVRResultSwitch::OnFailed;
 		return;
 	}
 
-	uint64 ret = VRSystem->GetUint64TrackedDeviceProperty(DeviceID, EnumPropertyValue, &pError);
-
-	if (pError != vr::TrackedPropertyError::TrackedProp_Success)
+	uint64 ret = 0;
+	if (!FOpenVRDevicePropertyCache::Get().GetUInt64Property(VRSystem, DeviceID, EnumPropertyValue, ret))
 	{
 		Result = EBPOVRResultSwitch::OnFailed;
 		return;
@@ -676,18 +653,15 @@ void UOpenVRExpansionFunctionLibrary::GetVRDevicePropertyMatrix34AsTransform(EVR
 		return;
 	}
 
-	vr::TrackedPropertyError pError = vr::TrackedPropertyError::TrackedProp_Success;
-
-	vr::ETrackedDeviceProperty EnumPropertyValue = VREnumToString(TEXT("EVRDeviceProperty_Matrix34"), static_cast<uint8>(PropertyToRetrieve));
+	vr::ETrackedDeviceProperty EnumPropertyValue = FOpenVRDevicePropertyCache::Get().GetPropertyEnum(TEXT("EVRDeviceProperty_Matrix34"), static_cast<uint8>(PropertyToRetrieve));
 	if (EnumPropertyValue == vr::ETrackedDeviceProperty::Prop_Invalid)
 	{
 		Result = EBPOVRResultSwitch::OnFailed;
 		return;
 	}
 
-	vr::HmdMatrix34_t ret = VRSystem->GetMatrix34TrackedDeviceProperty(DeviceID, EnumPropertyValue, &pError);
-
-	if (pError != vr::TrackedPropertyError::TrackedProp_Success)
+	vr::HmdMatrix34_t ret;
+	if (!FOpenVRDevicePropertyCache::Get().GetMatrix34Property(VRSystem, DeviceID, EnumPropertyValue, ret))
 	{
 		Result = EBPOVRResultSwitch::OnFailed;
 		return;
@@ -701,6 +675,96 @@ void UOpenVRExpansionFunctionLibrary::GetVRDevicePropertyMatrix34AsTransform(EVR
 }
 
 
+void UOpenVRExpansionFunctionLibrary::GetVRDevicePropertySnapshots(const TArray<EVRDeviceProperty_String> & StringProperties, const TArray<EVRDeviceProperty_Bool> & BoolProperties, const TArray<EVRDeviceProperty_Float> & FloatProperties, const TArray<EVRDeviceProperty_Int32> & Int32Properties, const TArray<EVRDeviceProperty_UInt64> & UInt64Properties, const TArray<EVRDeviceProperty_Matrix34> & Matrix34Properties, TArray<FBPOpenVRDevicePropertySnapshot> & Snapshots)
+{
+	Snapshots.Reset();
+
+#if !STEAMVR_SUPPORTED_PLATFORM
+	return;
+#else
+
+	if (!GEngine->XRSystem.IsValid() || (GEngine->XRSystem->GetSystemName() != SteamVRSystemName))
+		return;
+
+	vr::HmdError HmdErr;
+	vr::IVRSystem * VRSystem = (vr::IVRSystem*)vr::VR_GetGenericInterface(vr::IVRSystem_Version, &HmdErr);
+
+	if (!VRSystem)
+	{
+		UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("VRSystem InterfaceErrorCode %i in GetVRDevicePropertySnapshots"), (int32)HmdErr);
+		return;
+	}
+
+	FOpenVRDevicePropertyCache & PropertyCache = FOpenVRDevicePropertyCache::Get();
+	vr::ETrackedDeviceClass DeviceClass;
+
+	for (vr::TrackedDeviceIndex_t deviceIndex = vr::k_unTrackedDeviceIndex_Hmd; deviceIndex < vr::k_unMaxTrackedDeviceCount; ++deviceIndex)
+	{
+		if (!PropertyCache.IsDeviceConnected(VRSystem, deviceIndex, DeviceClass) || DeviceClass == vr::ETrackedDeviceClass::TrackedDeviceClass_Invalid)
+			continue;
+
+		FBPOpenVRDevicePropertySnapshot & Snapshot = Snapshots[Snapshots.AddDefaulted()];
+		Snapshot.DeviceID = deviceIndex;
+		Snapshot.bAllPropertiesSucceeded = true;
+
+		Snapshot.StringValues.SetNum(StringProperties.Num());
+		for (int32 i = 0; i < StringProperties.Num(); ++i)
+		{
+			vr::ETrackedDeviceProperty Property = PropertyCache.GetPropertyEnum(TEXT("EVRDeviceProperty_String"), static_cast<uint8>(StringProperties[i]));
+			Snapshot.bAllPropertiesSucceeded &= PropertyCache.GetStringProperty(VRSystem, deviceIndex, Property, Snapshot.StringValues[i]);
+		}
+
+		Snapshot.BoolValues.SetNumZeroed(BoolProperties.Num());
+		for (int32 i = 0; i < BoolProperties.Num(); ++i)
+		{
+			vr::ETrackedDeviceProperty Property = PropertyCache.GetPropertyEnum(TEXT("EVRDeviceProperty_Bool"), static_cast<uint8>(BoolProperties[i]));
+			Snapshot.bAllPropertiesSucceeded &= PropertyCache.GetBoolProperty(VRSystem, deviceIndex, Property, Snapshot.BoolValues[i]);
+		}
+
+		Snapshot.FloatValues.SetNumZeroed(FloatProperties.Num());
+		for (int32 i = 0; i < FloatProperties.Num(); ++i)
+		{
+			vr::ETrackedDeviceProperty Property = PropertyCache.GetPropertyEnum(TEXT("EVRDeviceProperty_Float"), static_cast<uint8>(FloatProperties[i]));
+			Snapshot.bAllPropertiesSucceeded &= PropertyCache.GetFloatProperty(VRSystem, deviceIndex, Property, Snapshot.FloatValues[i]);
+		}
+
+		Snapshot.Int32Values.SetNumZeroed(Int32Properties.Num());
+		for (int32 i = 0; i < Int32Properties.Num(); ++i)
+		{
+			vr::ETrackedDeviceProperty Property = PropertyCache.GetPropertyEnum(TEXT("EVRDeviceProperty_Int32"), static_cast<uint8>(Int32Properties[i]));
+			Snapshot.bAllPropertiesSucceeded &= PropertyCache.GetInt32Property(VRSystem, deviceIndex, Property, Snapshot.Int32Values[i]);
+		}
+
+		Snapshot.UInt64Values.SetNum(UInt64Properties.Num());
+		for (int32 i = 0; i < UInt64Properties.Num(); ++i)
+		{
+			vr::ETrackedDeviceProperty Property = PropertyCache.GetPropertyEnum(TEXT("EVRDeviceProperty_UInt64"), static_cast<uint8>(UInt64Properties[i]));
+			uint64 UInt64Value = 0;
+			Snapshot.bAllPropertiesSucceeded &= PropertyCache.GetUInt64Property(VRSystem, deviceIndex, Property, UInt64Value);
+			Snapshot.UInt64Values[i] = FString::Printf(TEXT("%llu"), UInt64Value);
+		}
+
+		Snapshot.Matrix34Values.Init(FTransform::Identity, Matrix34Properties.Num());
+		for (int32 i = 0; i < Matrix34Properties.Num(); ++i)
+		{
+			vr::ETrackedDeviceProperty Property = PropertyCache.GetPropertyEnum(TEXT("EVRDeviceProperty_Matrix34"), static_cast<uint8>(Matrix34Properties[i]));
+			vr::HmdMatrix34_t MatrixValue;
+			if (PropertyCache.GetMatrix34Property(VRSystem, deviceIndex, Property, MatrixValue))
+				Snapshot.Matrix34Values[i] = FTransform(ToFMatrix(MatrixValue));
+			else
+				Snapshot.bAllPropertiesSucceeded = false;
+		}
+	}
+#endif
+}
+
+void UOpenVRExpansionFunctionLibrary::InvalidateVRDevicePropertyCache(int32 DeviceID)
+{
+#if STEAMVR_SUPPORTED_PLATFORM
+	FOpenVRDevicePropertyCache::Get().InvalidateDevice(DeviceID);
+#endif
+}
+
 EBPOpenVRTrackedDeviceClass UOpenVRExpansionFunctionLibrary::GetOpenVRDeviceType(int32 OpenVRDeviceIndex)
 {
 #if !STEAMVR_SUPPORTED_PLATFORM
@@ -794,13 +858,10 @@ bool UOpenVRExpansionFunctionLibrary::IsOpenVRDeviceConnected(int32 OpenVRDevice
 #endif
 }
 
-UTexture2D * UOpenVRExpansionFunctionLibrary::GetVRDeviceModelAndTexture(UObject* WorldContextObject, EBPOpenVRTrackedDeviceClass DeviceType, TArray<UProceduralMeshComponent *> ProceduralMeshComponentsToFill, bool bCreateCollision, EAsyncBlueprintResultSwitch &Result, int32 OverrideDeviceID)
+bool UOpenVRExpansionFunctionLibrary::GetRenderModelNameForDevice(EBPOpenVRTrackedDeviceClass DeviceType, int32 OverrideDeviceID, FString & RenderModelName)
 {
-
 #if !STEAMVR_SUPPORTED_PLATFORM
-	UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Not SteamVR Supported Platform!!"));
-	Result = EAsyncBlueprintResultSwitch::OnFailure;
-	return NULL;
+	return false;
 #else
 
 	vr::HmdError HmdErr;
@@ -810,22 +871,7 @@ UTexture2D * UOpenVRExpansionFunctionLibrary::GetVRDeviceModelAndTexture(UObject
 	if (!VRSystem)
 	{
 		UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("VRSystem InterfaceErrorCode %i"), (int32)HmdErr);
-	}
-
-	//vr::IVRRenderModels * VRRenderModels = (vr::IVRRenderModels*)(*VRGetGenericInterfaceFn)(vr::IVRRenderModels_Version, &HmdErr);
-	vr::IVRRenderModels * VRRenderModels = (vr::IVRRenderModels*)vr::VR_GetGenericInterface(vr::IVRRenderModels_Version, &HmdErr);
-
-	if (!VRRenderModels)
-	{
-		UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Render Models InterfaceErrorCode %i"), (int32)HmdErr);
-	}
-
-
-	if (!VRSystem || !VRRenderModels)
-	{
-		UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Couldn't Get Interfaces!!"));
-		Result = EAsyncBlueprintResultSwitch::OnFailure;
-		return nullptr;
+		return false;
 	}
 
 	int32 DeviceID = 0;
@@ -835,8 +881,7 @@ UTexture2D * UOpenVRExpansionFunctionLibrary::GetVRDeviceModelAndTexture(UObject
 		if (OverrideDeviceID > (vr::k_unMaxTrackedDeviceCount - 1) || VRSystem->GetTrackedDeviceClass(DeviceID) == vr::k_unTrackedDeviceIndexInvalid)
 		{
 			UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Override Tracked Device Was Missing!!"));
-			Result = EAsyncBlueprintResultSwitch::OnFailure;
-			return nullptr;
+			return false;
 		}
 	}
 	else
@@ -847,8 +892,7 @@ UTexture2D * UOpenVRExpansionFunctionLibrary::GetVRDeviceModelAndTexture(UObject
 		if (FoundIDs.Num() == 0)
 		{
 			UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Couldn't Get Tracked Devices!!"));
-			Result = EAsyncBlueprintResultSwitch::OnFailure;
-			return nullptr;
+			return false;
 		}
 
 		DeviceID = FoundIDs[0];
@@ -856,165 +900,90 @@ UTexture2D * UOpenVRExpansionFunctionLibrary::GetVRDeviceModelAndTexture(UObject
 
 	vr::TrackedPropertyError pError = vr::TrackedPropertyError::TrackedProp_Success;
 
-	char RenderModelName[vr::k_unMaxPropertyStringSize];
+	char RenderModelNameChars[vr::k_unMaxPropertyStringSize];
 	uint32_t buffersize = vr::k_unMaxPropertyStringSize;
-	uint32_t ret = VRSystem->GetStringTrackedDeviceProperty(DeviceID, vr::ETrackedDeviceProperty::Prop_RenderModelName_String, RenderModelName, buffersize, &pError);
+	VRSystem->GetStringTrackedDeviceProperty(DeviceID, vr::ETrackedDeviceProperty::Prop_RenderModelName_String, RenderModelNameChars, buffersize, &pError);
 
 	if (pError != vr::TrackedPropertyError::TrackedProp_Success)
 	{
 		UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Couldn't Get Render Model Name String!!"));
-		Result = EAsyncBlueprintResultSwitch::OnFailure;
-		return nullptr;
+		return false;
 	}
 
-	//uint32_t numComponents = VRRenderModels->GetComponentCount("vr_controller_vive_1_5");
-	//UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("NumComponents: %i"), (int32)numComponents);
-	// if numComponents > 0 load each, otherwise load the main one only
-
-	vr::RenderModel_t *RenderModel = NULL;
+	RenderModelName = FString(ANSI_TO_TCHAR(RenderModelNameChars));
+	return true;
+#endif
+}
 
-	//VRRenderModels->LoadRenderModel()
-	vr::EVRRenderModelError ModelErrorCode = VRRenderModels->LoadRenderModel_Async(RenderModelName, &RenderModel);
-	
-	if (ModelErrorCode != vr::EVRRenderModelError::VRRenderModelError_None)
-	{
-		if (ModelErrorCode != vr::EVRRenderModelError::VRRenderModelError_Loading)
-		{
-			UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Couldn't Load Model!!"));
-			Result = EAsyncBlueprintResultSwitch::OnFailure;
-		}
-		else
-			Result = EAsyncBlueprintResultSwitch::AsyncLoading;
+UTexture2D * UOpenVRExpansionFunctionLibrary::GetVRDeviceModelAndTexture(UObject* WorldContextObject, EBPOpenVRTrackedDeviceClass DeviceType, TArray<UProceduralMeshComponent *> ProceduralMeshComponentsToFill, bool bCreateCollision, EAsyncBlueprintResultSwitch &Result, int32 OverrideDeviceID)
+{
 
-		return nullptr;
-	}
+#if !STEAMVR_SUPPORTED_PLATFORM
+	UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Not SteamVR Supported Platform!!"));
+	Result = EAsyncBlueprintResultSwitch::OnFailure;
+	return NULL;
+#else
 
-	if (!RenderModel)
+	FString RenderModelName;
+	if (!GetRenderModelNameForDevice(DeviceType, OverrideDeviceID, RenderModelName))
 	{
-		UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Couldn't Load Model!!"));
 		Result = EAsyncBlueprintResultSwitch::OnFailure;
 		return nullptr;
 	}
 
-	vr::TextureID_t texID = RenderModel->diffuseTextureId;
-	vr::RenderModel_TextureMap_t * texture = NULL;
-	UTexture2D* OutTexture = nullptr;
+	// Loading and conversion happens once per model name, polling just checks the cache state and sees failures until the retry cooldown passes
+	TSharedPtr<FOpenVRRenderModelEntry, ESPMode::ThreadSafe> Entry = FOpenVRRenderModelCache::Get().FindOrLoad(RenderModelName);
 
-	if (texID != vr::INVALID_TEXTURE_ID)
+	switch (Entry->GetLoadState())
 	{
-		//UTexture2DDynamic * OutTexture = nullptr;
-		vr::EVRRenderModelError TextureErrorCode = VRRenderModels->LoadTexture_Async(texID, &texture);
-
-		if (TextureErrorCode != vr::EVRRenderModelError::VRRenderModelError_None)
-		{
-			if (TextureErrorCode != vr::EVRRenderModelError::VRRenderModelError_Loading)
-			{
-				UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Couldn't Load Texture!!"));
-				Result = EAsyncBlueprintResultSwitch::OnFailure;
-			}
-			else
-				Result = EAsyncBlueprintResultSwitch::AsyncLoading;
-
-			return nullptr;
-		}
-
-		if (!texture)
-		{
-			UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Couldn't Load Texture!!"));
-			Result = EAsyncBlueprintResultSwitch::OnFailure;
-			return nullptr;
-		}
-	}
-
-	if (ProceduralMeshComponentsToFill.Num() > 0)
+	case EOpenVRRenderModelLoadState::Loading:
 	{
-		TArray<FVector> vertices;
-		TArray<int32> triangles;
-		TArray<FVector> normals;
-		TArray<FVector2D> UV0;
-		TArray<FColor> vertexColors;
-		TArray<FProcMeshTangent> tangents;
-		
-		vr::HmdVector3_t vPosition;
-		vr::HmdVector3_t vNormal;
-
-		vertices.Reserve(RenderModel->unVertexCount);
-		normals.Reserve(RenderModel->unVertexCount);
-		UV0.Reserve(RenderModel->unVertexCount);
-	
-		for (uint32_t i = 0; i < RenderModel->unVertexCount; ++i)
-		{
-			vPosition = RenderModel->rVertexData[i].vPosition;
-			// OpenVR y+ Up, +x Right, -z Going away
-			// UE4 z+ up, +y right, +x forward
-
-			vertices.Add(FVector(-vPosition.v[2], vPosition.v[0], vPosition.v[1]));
-
-			vNormal = RenderModel->rVertexData[i].vNormal;
-
-			normals.Add(FVector(-vNormal.v[2], vNormal.v[0], vNormal.v[1]));
-
-			UV0.Add(FVector2D(RenderModel->rVertexData[i].rfTextureCoord[0], RenderModel->rVertexData[i].rfTextureCoord[1]));
-		}
-
-		triangles.Reserve(RenderModel->unTriangleCount);
-		for (uint32_t i = 0; i < RenderModel->unTriangleCount * 3; i += 3)
-		{
-			triangles.Add(RenderModel->rIndexData[i]);
-			triangles.Add(RenderModel->rIndexData[i + 1]);
-			triangles.Add(RenderModel->rIndexData[i + 2]);
-		}
-
-		float scale = UHeadMountedDisplayFunctionLibrary::GetWorldToMetersScale(WorldContextObject);
-		for (int i = 0; i < ProceduralMeshComponentsToFill.Num(); ++i)
-		{
-			ProceduralMeshComponentsToFill[i]->ClearAllMeshSections();
-			ProceduralMeshComponentsToFill[i]->CreateMeshSection(0, vertices, triangles, normals, UV0, vertexColors, tangents, bCreateCollision);
-			ProceduralMeshComponentsToFill[i]->SetMeshSectionVisible(0, true);
-			ProceduralMeshComponentsToFill[i]->SetWorldScale3D(FVector(scale, scale, scale));
-		}
-	}
-
-	if (texture != nullptr)
+		Result = EAsyncBlueprintResultSwitch::AsyncLoading;
+		return nullptr;
+	}break;
+	case EOpenVRRenderModelLoadState::Failed:
 	{
-		uint32 Width = texture->unWidth;
-		uint32 Height = texture->unHeight;
-
-
-		//OutTexture = UTexture2DDynamic::Create(Width, Height, PF_R8G8B8A8);
-		OutTexture = UTexture2D::CreateTransient(Width, Height, PF_R8G8B8A8);
-
+		UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Couldn't Load Model!!"));
+		Result = EAsyncBlueprintResultSwitch::OnFailure;
+		return nullptr;
+	}break;
+	default:break;
+	}
 
-		//FTexture2DDynamicResource * TexResource = static_cast<FTexture2DDynamicResource*>(OutTexture->Resource);
-		//FTexture2DRHIParamRef TextureRHI = TexResource->GetTexture2DRHI();
+	Entry->FillProceduralMeshComponents(WorldContextObject, ProceduralMeshComponentsToFill, bCreateCollision);
 
-		//uint32 DestStride = 0;
-		//uint8* MipData = reinterpret_cast<uint8*>(RHILockTexture2D(TextureRHI, 0, RLM_WriteOnly, DestStride, false, false));
+	Result = EAsyncBlueprintResultSwitch::OnSuccess;
+	return Entry->GetOrCreateTexture();
+#endif
+}
 
-		uint8* MipData = (uint8*)OutTexture->PlatformData->Mips[0].BulkData.Lock(LOCK_READ_WRITE);
-		FMemory::Memcpy(MipData, (void*)texture->rubTextureMapData, Height * Width * 4);
-		OutTexture->PlatformData->Mips[0].BulkData.Unlock();
-		//RHIUnlockTexture2D(TextureRHI, 0, false, false);
+void UOpenVRExpansionFunctionLibrary::GetVRDeviceModelAndTextureAsync(UObject* WorldContextObject, FLatentActionInfo LatentInfo, EBPOpenVRTrackedDeviceClass DeviceType, TArray<UProceduralMeshComponent *> ProceduralMeshComponentsToFill, bool bCreateCollision, UTexture2D *& OutTexture, bool & bSucceeded, int32 OverrideDeviceID)
+{
+	OutTexture = nullptr;
+	bSucceeded = false;
 
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	if (!World)
+		return;
 
-		//Setting some Parameters for the Texture and finally returning it
-		OutTexture->PlatformData->NumSlices = 1;
-		OutTexture->NeverStream = true;
-		OutTexture->UpdateResource();
+	FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+	if (LatentActionManager.FindExistingAction<FOpenVRRenderModelLatentAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) != nullptr)
+		return;
 
-		/*if (bReturnRawTexture)
-		{
-			OutRawTexture.AddUninitialized(Height * Width * 4);
-			FMemory::Memcpy(OutRawTexture.GetData(), (void*)texture->rubTextureMapData, Height * Width * 4);
-		}*/
+	TSharedPtr<FOpenVRRenderModelEntry, ESPMode::ThreadSafe> Entry;
 
-		Result = EAsyncBlueprintResultSwitch::OnSuccess;
-		VRRenderModels->FreeTexture(texture);
+#if STEAMVR_SUPPORTED_PLATFORM
+	FString RenderModelName;
+	if (GetRenderModelNameForDevice(DeviceType, OverrideDeviceID, RenderModelName))
+	{
+		Entry = FOpenVRRenderModelCache::Get().FindOrLoad(RenderModelName);
 	}
-
-	VRRenderModels->FreeRenderModel(RenderModel);
-	return OutTexture;
+#else
+	UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Not SteamVR Supported Platform!!"));
 #endif
+
+	// A null entry finishes on the first update with bSucceeded = false
+	LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FOpenVRRenderModelLatentAction(Entry, WorldContextObject, ProceduralMeshComponentsToFill, bCreateCollision, OutTexture, bSucceeded, LatentInfo));
 }
 
 
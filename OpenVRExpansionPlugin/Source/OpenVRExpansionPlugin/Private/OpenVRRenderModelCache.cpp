@@ -0,0 +1,399 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "OpenVRRenderModelCache.h"
+#include "OpenVRExpansionFunctionLibrary.h"
+#include "Engine/Texture2D.h"
+#include "Engine/Engine.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "HeadMountedDisplayFunctionLibrary.h"
+
+// How long SteamVR gets to finish loading a model or texture before the load fails
+static const double OpenVRRenderModelLoadTimeout = 10.0;
+
+// How long a failed model keeps being reported as failed before a request retries it
+static const double OpenVRRenderModelRetryCooldown = 30.0;
+
+/**
+* A load that is waiting on SteamVR or on its conversion, only touched on the game thread.
+*/
+struct FOpenVRRenderModelPendingLoad
+{
+	TSharedPtr<FOpenVRRenderModelEntry, ESPMode::ThreadSafe> Entry;
+	double StartTime;
+
+#if STEAMVR_SUPPORTED_PLATFORM
+	vr::RenderModel_t * RenderModel;
+	vr::RenderModel_TextureMap_t * Texture;
+#endif
+
+	// Converts the loaded model, the SteamVR data is freed on the game thread once it is done
+	TFuture<void> ConvertTask;
+
+	FOpenVRRenderModelPendingLoad(TSharedPtr<FOpenVRRenderModelEntry, ESPMode::ThreadSafe> InEntry) :
+		Entry(InEntry),
+		StartTime(FPlatformTime::Seconds())
+#if STEAMVR_SUPPORTED_PLATFORM
+		, RenderModel(nullptr)
+		, Texture(nullptr)
+#endif
+	{}
+};
+
+static TUniquePtr<FOpenVRRenderModelCache> GOpenVRRenderModelCache;
+
+FOpenVRRenderModelCache::~FOpenVRRenderModelCache()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+
+	// Conversions read the SteamVR data, let them finish. The data itself is left to SteamVR, its interfaces may be gone at this point
+	for (TSharedPtr<FOpenVRRenderModelPendingLoad> & PendingLoad : PendingLoads)
+	{
+		if (PendingLoad->ConvertTask.IsValid())
+			PendingLoad->ConvertTask.Wait();
+	}
+}
+
+FOpenVRRenderModelCache & FOpenVRRenderModelCache::Get()
+{
+	check(IsInGameThread());
+
+	if (!GOpenVRRenderModelCache.IsValid())
+	{
+		GOpenVRRenderModelCache = MakeUnique<FOpenVRRenderModelCache>();
+	}
+
+	return *GOpenVRRenderModelCache;
+}
+
+void FOpenVRRenderModelCache::Shutdown()
+{
+	GOpenVRRenderModelCache.Reset();
+}
+
+void FOpenVRRenderModelCache::Empty()
+{
+	CachedModels.Empty();
+}
+
+void FOpenVRRenderModelCache::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (TPair<FString, TSharedPtr<FOpenVRRenderModelEntry, ESPMode::ThreadSafe>> & CachedModel : CachedModels)
+	{
+		if (CachedModel.Value.IsValid() && CachedModel.Value->Texture)
+		{
+			Collector.AddReferencedObject(CachedModel.Value->Texture);
+		}
+	}
+}
+
+TSharedPtr<FOpenVRRenderModelEntry, ESPMode::ThreadSafe> FOpenVRRenderModelCache::FindOrLoad(const FString & RenderModelName, bool bRetryFailed)
+{
+	check(IsInGameThread());
+
+	if (TSharedPtr<FOpenVRRenderModelEntry, ESPMode::ThreadSafe> * FoundEntry = CachedModels.Find(RenderModelName))
+	{
+		// Failed loads are kept so that pollers see the failure, the runtime may not have had the model available at the time so they can be retried later
+		const FOpenVRRenderModelEntry & Entry = **FoundEntry;
+		if (Entry.GetLoadState() != EOpenVRRenderModelLoadState::Failed || (!bRetryFailed && FPlatformTime::Seconds() - Entry.FailedTime < OpenVRRenderModelRetryCooldown))
+			return *FoundEntry;
+	}
+
+	TSharedPtr<FOpenVRRenderModelEntry, ESPMode::ThreadSafe> NewEntry = MakeShareable(new FOpenVRRenderModelEntry(RenderModelName));
+	CachedModels.Add(RenderModelName, NewEntry);
+
+	TSharedPtr<FOpenVRRenderModelPendingLoad> PendingLoad = MakeShareable(new FOpenVRRenderModelPendingLoad(NewEntry));
+
+	// SteamVR may already have it loaded, only wait on the ticker if it doesn't
+	if (!UpdatePendingLoad(*PendingLoad))
+	{
+		PendingLoads.Add(PendingLoad);
+
+		if (!TickerHandle.IsValid())
+		{
+			TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FOpenVRRenderModelCache::Tick));
+		}
+	}
+
+	return NewEntry;
+}
+
+bool FOpenVRRenderModelCache::Tick(float DeltaTime)
+{
+	for (int32 i = PendingLoads.Num() - 1; i >= 0; --i)
+	{
+		if (UpdatePendingLoad(*PendingLoads[i]))
+			PendingLoads.RemoveAtSwap(i);
+	}
+
+	if (PendingLoads.Num() == 0)
+	{
+		TickerHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+#if STEAMVR_SUPPORTED_PLATFORM
+namespace OpenVRRenderModelCache
+{
+	void ConvertRenderModel(FOpenVRRenderModelEntry & Entry, const vr::RenderModel_t & RenderModel, const vr::RenderModel_TextureMap_t * Texture)
+	{
+		vr::HmdVector3_t vPosition;
+		vr::HmdVector3_t vNormal;
+
+		Entry.Vertices.Reserve(RenderModel.unVertexCount);
+		Entry.Normals.Reserve(RenderModel.unVertexCount);
+		Entry.UV0.Reserve(RenderModel.unVertexCount);
+
+		for (uint32_t i = 0; i < RenderModel.unVertexCount; ++i)
+		{
+			vPosition = RenderModel.rVertexData[i].vPosition;
+			// OpenVR y+ Up, +x Right, -z Going away
+			// UE4 z+ up, +y right, +x forward
+
+			Entry.Vertices.Add(FVector(-vPosition.v[2], vPosition.v[0], vPosition.v[1]));
+
+			vNormal = RenderModel.rVertexData[i].vNormal;
+
+			Entry.Normals.Add(FVector(-vNormal.v[2], vNormal.v[0], vNormal.v[1]));
+
+			Entry.UV0.Add(FVector2D(RenderModel.rVertexData[i].rfTextureCoord[0], RenderModel.rVertexData[i].rfTextureCoord[1]));
+		}
+
+		Entry.Triangles.Reserve(RenderModel.unTriangleCount * 3);
+		for (uint32_t i = 0; i < RenderModel.unTriangleCount * 3; i += 3)
+		{
+			Entry.Triangles.Add(RenderModel.rIndexData[i]);
+			Entry.Triangles.Add(RenderModel.rIndexData[i + 1]);
+			Entry.Triangles.Add(RenderModel.rIndexData[i + 2]);
+		}
+
+		if (Texture != nullptr)
+		{
+			Entry.TextureWidth = Texture->unWidth;
+			Entry.TextureHeight = Texture->unHeight;
+
+			uint32 TextureSize = Entry.TextureWidth * Entry.TextureHeight * 4;
+			Entry.TextureData.SetNumUninitialized(TextureSize);
+			FMemory::Memcpy(Entry.TextureData.GetData(), (void*)Texture->rubTextureMapData, TextureSize);
+		}
+	}
+
+	void FreeSteamVRData(FOpenVRRenderModelPendingLoad & PendingLoad, vr::IVRRenderModels * VRRenderModels)
+	{
+		if (VRRenderModels)
+		{
+			if (PendingLoad.Texture)
+				VRRenderModels->FreeTexture(PendingLoad.Texture);
+
+			if (PendingLoad.RenderModel)
+				VRRenderModels->FreeRenderModel(PendingLoad.RenderModel);
+		}
+
+		PendingLoad.Texture = nullptr;
+		PendingLoad.RenderModel = nullptr;
+	}
+
+	bool FailPendingLoad(FOpenVRRenderModelPendingLoad & PendingLoad, vr::IVRRenderModels * VRRenderModels)
+	{
+		FreeSteamVRData(PendingLoad, VRRenderModels);
+		PendingLoad.Entry->FailedTime = FPlatformTime::Seconds();
+		PendingLoad.Entry->LoadState.Set((int32)EOpenVRRenderModelLoadState::Failed);
+		return true;
+	}
+
+	// Still loading is fine until the timeout, after that the load fails
+	bool WaitOrTimeout(FOpenVRRenderModelPendingLoad & PendingLoad, vr::IVRRenderModels * VRRenderModels, const TCHAR * What)
+	{
+		if (FPlatformTime::Seconds() - PendingLoad.StartTime < OpenVRRenderModelLoadTimeout)
+			return false;
+
+		UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Timed out loading %s for %s!!"), What, *PendingLoad.Entry->RenderModelName);
+		return FailPendingLoad(PendingLoad, VRRenderModels);
+	}
+}
+#endif
+
+bool FOpenVRRenderModelCache::UpdatePendingLoad(FOpenVRRenderModelPendingLoad & PendingLoad)
+{
+	check(IsInGameThread());
+
+#if !STEAMVR_SUPPORTED_PLATFORM
+	PendingLoad.Entry->FailedTime = FPlatformTime::Seconds();
+	PendingLoad.Entry->LoadState.Set((int32)EOpenVRRenderModelLoadState::Failed);
+	return true;
+#else
+	using namespace OpenVRRenderModelCache;
+
+	vr::HmdError HmdErr;
+	vr::IVRRenderModels * VRRenderModels = (vr::IVRRenderModels*)vr::VR_GetGenericInterface(vr::IVRRenderModels_Version, &HmdErr);
+
+	if (PendingLoad.ConvertTask.IsValid())
+	{
+		if (!PendingLoad.ConvertTask.IsReady())
+			return false;
+
+		FreeSteamVRData(PendingLoad, VRRenderModels);
+
+		// Publish the converted data
+		FPlatformMisc::MemoryBarrier();
+		PendingLoad.Entry->LoadState.Set((int32)EOpenVRRenderModelLoadState::Loaded);
+		return true;
+	}
+
+	if (!VRRenderModels)
+	{
+		UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Render Models InterfaceErrorCode %i"), (int32)HmdErr);
+		return FailPendingLoad(PendingLoad, VRRenderModels);
+	}
+
+	if (!PendingLoad.RenderModel)
+	{
+		vr::EVRRenderModelError ModelErrorCode = VRRenderModels->LoadRenderModel_Async(TCHAR_TO_ANSI(*PendingLoad.Entry->RenderModelName), &PendingLoad.RenderModel);
+
+		if (ModelErrorCode == vr::EVRRenderModelError::VRRenderModelError_Loading)
+			return WaitOrTimeout(PendingLoad, VRRenderModels, TEXT("model"));
+
+		if (ModelErrorCode != vr::EVRRenderModelError::VRRenderModelError_None || !PendingLoad.RenderModel)
+		{
+			UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Couldn't Load Model %s!!"), *PendingLoad.Entry->RenderModelName);
+			PendingLoad.RenderModel = nullptr;
+			return FailPendingLoad(PendingLoad, VRRenderModels);
+		}
+	}
+
+	if (PendingLoad.RenderModel->diffuseTextureId != vr::INVALID_TEXTURE_ID && !PendingLoad.Texture)
+	{
+		vr::EVRRenderModelError TextureErrorCode = VRRenderModels->LoadTexture_Async(PendingLoad.RenderModel->diffuseTextureId, &PendingLoad.Texture);
+
+		if (TextureErrorCode == vr::EVRRenderModelError::VRRenderModelError_Loading)
+			return WaitOrTimeout(PendingLoad, VRRenderModels, TEXT("texture"));
+
+		if (TextureErrorCode != vr::EVRRenderModelError::VRRenderModelError_None || !PendingLoad.Texture)
+		{
+			UE_LOG(OpenVRExpansionFunctionLibraryLog, Warning, TEXT("Couldn't Load Texture for %s!!"), *PendingLoad.Entry->RenderModelName);
+			PendingLoad.Texture = nullptr;
+			return FailPendingLoad(PendingLoad, VRRenderModels);
+		}
+	}
+
+	// Everything is loaded on the SteamVR side, the conversion only reads the loaded data so it can run off of the game thread
+	TSharedPtr<FOpenVRRenderModelEntry, ESPMode::ThreadSafe> Entry = PendingLoad.Entry;
+	const vr::RenderModel_t * RenderModel = PendingLoad.RenderModel;
+	const vr::RenderModel_TextureMap_t * Texture = PendingLoad.Texture;
+
+	PendingLoad.ConvertTask = Async<void>(EAsyncExecution::ThreadPool, [Entry, RenderModel, Texture]()
+	{
+		ConvertRenderModel(*Entry, *RenderModel, Texture);
+	});
+
+	return false;
+#endif
+}
+
+UTexture2D * FOpenVRRenderModelEntry::GetOrCreateTexture()
+{
+	check(IsInGameThread());
+
+	if (Texture || GetLoadState() != EOpenVRRenderModelLoadState::Loaded || TextureData.Num() == 0)
+		return Texture;
+
+	Texture = UTexture2D::CreateTransient(TextureWidth, TextureHeight, PF_R8G8B8A8);
+
+	if (!Texture)
+		return nullptr;
+
+	uint8* MipData = (uint8*)Texture->PlatformData->Mips[0].BulkData.Lock(LOCK_READ_WRITE);
+	FMemory::Memcpy(MipData, TextureData.GetData(), TextureData.Num());
+	Texture->PlatformData->Mips[0].BulkData.Unlock();
+
+	//Setting some Parameters for the Texture and finally returning it
+	Texture->PlatformData->NumSlices = 1;
+	Texture->NeverStream = true;
+	Texture->UpdateResource();
+
+	// The texture owns the texels now
+	TextureData.Empty();
+
+	return Texture;
+}
+
+void FOpenVRRenderModelEntry::FillProceduralMeshComponents(UObject* WorldContextObject, const TArray<UProceduralMeshComponent *> & ProceduralMeshComponentsToFill, bool bCreateCollision) const
+{
+	check(IsInGameThread());
+
+	if (ProceduralMeshComponentsToFill.Num() <= 0 || GetLoadState() != EOpenVRRenderModelLoadState::Loaded)
+		return;
+
+	TArray<FColor> vertexColors;
+	TArray<FProcMeshTangent> tangents;
+
+	float scale = UHeadMountedDisplayFunctionLibrary::GetWorldToMetersScale(WorldContextObject);
+	for (UProceduralMeshComponent * ProcMesh : ProceduralMeshComponentsToFill)
+	{
+		if (!ProcMesh)
+			continue;
+
+		ProcMesh->ClearAllMeshSections();
+		ProcMesh->CreateMeshSection(0, Vertices, Triangles, Normals, UV0, vertexColors, tangents, bCreateCollision);
+		ProcMesh->SetMeshSectionVisible(0, true);
+		ProcMesh->SetWorldScale3D(FVector(scale, scale, scale));
+	}
+}
+
+FOpenVRRenderModelLatentAction::FOpenVRRenderModelLatentAction(TSharedPtr<FOpenVRRenderModelEntry, ESPMode::ThreadSafe> InEntry, UObject* InWorldContextObject, const TArray<UProceduralMeshComponent *> & InComponents, bool bInCreateCollision, UTexture2D *& InOutTexture, bool & bInSucceeded, const FLatentActionInfo& LatentInfo) :
+	Entry(InEntry),
+	WorldContextObject(InWorldContextObject),
+	bCreateCollision(bInCreateCollision),
+	OutTexture(InOutTexture),
+	bSucceeded(bInSucceeded),
+	ExecutionFunction(LatentInfo.ExecutionFunction),
+	OutputLink(LatentInfo.Linkage),
+	CallbackTarget(LatentInfo.CallbackTarget)
+{
+	for (UProceduralMeshComponent * ProcMesh : InComponents)
+	{
+		ProceduralMeshComponentsToFill.Add(ProcMesh);
+	}
+}
+
+void FOpenVRRenderModelLatentAction::UpdateOperation(FLatentResponse& Response)
+{
+	if (!Entry.IsValid())
+	{
+		bSucceeded = false;
+		Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+		return;
+	}
+
+	EOpenVRRenderModelLoadState LoadState = Entry->GetLoadState();
+
+	if (LoadState == EOpenVRRenderModelLoadState::Loading)
+		return;
+
+	if (LoadState == EOpenVRRenderModelLoadState::Loaded)
+	{
+		TArray<UProceduralMeshComponent *> ValidComponents;
+		for (const TWeakObjectPtr<UProceduralMeshComponent> & ProcMesh : ProceduralMeshComponentsToFill)
+		{
+			if (ProcMesh.IsValid())
+				ValidComponents.Add(ProcMesh.Get());
+		}
+
+		Entry->FillProceduralMeshComponents(WorldContextObject.Get(), ValidComponents, bCreateCollision);
+		OutTexture = Entry->GetOrCreateTexture();
+		bSucceeded = true;
+	}
+	else
+	{
+		OutTexture = nullptr;
+		bSucceeded = false;
+	}
+
+	Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+}
@@ -0,0 +1,112 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "UObject/Object.h"
+#include "Engine/Texture2D.h"
+#include "RenderCommandFence.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "OpenVRExpansionFunctionLibrary.h"
+
+#include "OpenVRCameraFeed.generated.h"
+
+// Number of staging buffers kept in the ring, one is written by the game thread while the others can be in flight on the render thread
+#define OPENVR_CAMERA_FEED_STAGING_BUFFERS 3
+
+/**
+* Fixed ring of staging buffers for the camera feed, allocated once at the frame size and never re-allocated.
+* Shared with the render thread so that in flight uploads keep their buffer alive even if the feed is destroyed.
+*/
+struct FOpenVRCameraFeedStaging
+{
+	TArray<uint8> Buffers[OPENVR_CAMERA_FEED_STAGING_BUFFERS];
+
+	// Non zero while the render thread still has a pending upload from the slot
+	FThreadSafeCounter InFlight[OPENVR_CAMERA_FEED_STAGING_BUFFERS];
+
+	int32 NextBuffer;
+
+	FOpenVRCameraFeedStaging() :
+		NextBuffer(0)
+	{}
+
+	void Allocate(uint32 BufferSize)
+	{
+		for (int32 i = 0; i < OPENVR_CAMERA_FEED_STAGING_BUFFERS; ++i)
+		{
+			Buffers[i].SetNumUninitialized(BufferSize, false);
+			InFlight[i].Reset();
+		}
+
+		NextBuffer = 0;
+	}
+
+	// Returns the next free slot in the ring or INDEX_NONE if all of them are still waiting on the render thread
+	int32 AcquireBuffer()
+	{
+		for (int32 i = 0; i < OPENVR_CAMERA_FEED_STAGING_BUFFERS; ++i)
+		{
+			int32 Slot = (NextBuffer + i) % OPENVR_CAMERA_FEED_STAGING_BUFFERS;
+			if (InFlight[Slot].GetValue() == 0)
+			{
+				NextBuffer = (Slot + 1) % OPENVR_CAMERA_FEED_STAGING_BUFFERS;
+				return Slot;
+			}
+		}
+
+		return INDEX_NONE;
+	}
+};
+
+/**
+* Streaming feed for the SteamVR tracked camera.
+* Unlike GetVRCameraFrame this owns its texture and a fixed ring of staging buffers, skips frames that the camera
+* has not advanced since the last update, and uploads into the same RHI resource every time, so calling it per frame
+* for passthrough does no per frame allocations.
+*/
+UCLASS(BlueprintType, Category = "VRExpansionFunctions|SteamVR|VRCamera")
+class OPENVREXPANSIONPLUGIN_API UOpenVRCameraFeed : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UOpenVRCameraFeed(const FObjectInitializer& ObjectInitializer);
+
+	virtual void BeginDestroy() override;
+	virtual bool IsReadyForFinishDestroy() override;
+
+	// Creates a camera feed for an acquired camera handle, the camera handle still needs to be released by the user when done
+	UFUNCTION(BlueprintCallable, Category = "VRExpansionFunctions|SteamVR|VRCamera", meta = (WorldContext = "WorldContextObject", DisplayName = "CreateOpenVRCameraFeed", ExpandEnumAsExecs = "Result"))
+	static UOpenVRCameraFeed * CreateOpenVRCameraFeed(UObject* WorldContextObject, UPARAM(ref) FBPOpenVRCameraHandle & CameraHandle, EOpenVRCameraFrameType FrameType, EBPOVRResultSwitch & Result);
+
+	// Pulls the latest camera frame into CameraTexture, bNewFrame is false if the camera has not produced a new frame since the last update
+	UFUNCTION(BlueprintCallable, Category = "VRExpansionFunctions|SteamVR|VRCamera", meta = (DisplayName = "UpdateCameraFeed", ExpandEnumAsExecs = "Result"))
+	void UpdateCameraFeed(bool & bNewFrame, EBPOVRResultSwitch & Result);
+
+	// The texture the camera feed is uploaded to, this is the same texture (and RHI resource) for the lifetime of the feed
+	UPROPERTY(BlueprintReadOnly, Category = "VRExpansionFunctions|SteamVR|VRCamera")
+	UTexture2D * CameraTexture;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VRExpansionFunctions|SteamVR|VRCamera")
+	EOpenVRCameraFrameType FrameType;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VRExpansionFunctions|SteamVR|VRCamera")
+	FBPOpenVRCameraHandle CameraHandle;
+
+	// Sequence number of the last frame that was uploaded to the texture
+	UPROPERTY(BlueprintReadOnly, Category = "VRExpansionFunctions|SteamVR|VRCamera")
+	int32 LastFrameSequence;
+
+private:
+
+	bool InitializeFeed();
+
+	uint32 FrameWidth;
+	uint32 FrameHeight;
+	uint32 FrameBufferSize;
+
+	TSharedPtr<FOpenVRCameraFeedStaging, ESPMode::ThreadSafe> Staging;
+	FRenderCommandFence ReleaseFence;
+};
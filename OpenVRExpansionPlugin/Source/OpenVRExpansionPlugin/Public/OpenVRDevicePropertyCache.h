@@ -0,0 +1,89 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OpenVRExpansionFunctionLibrary.h"
+
+#if STEAMVR_SUPPORTED_PLATFORM
+
+/**
+* Snapshot of the tracked device properties that have been requested for a single device.
+* Values are filled lazily on first request and dropped together when the snapshot goes stale.
+*/
+struct FOpenVRDevicePropertySnapshot
+{
+	template<typename ValueType>
+	struct TCachedValue
+	{
+		ValueType Value;
+		bool bSucceeded;
+	};
+
+	bool bConnected;
+	vr::ETrackedDeviceClass DeviceClass;
+	uint64 LastValidatedFrame;
+	double LastRefreshTime;
+
+	TMap<int32, TCachedValue<FString>> StringValues;
+	TMap<int32, TCachedValue<bool>> BoolValues;
+	TMap<int32, TCachedValue<float>> FloatValues;
+	TMap<int32, TCachedValue<int32>> Int32Values;
+	TMap<int32, TCachedValue<uint64>> UInt64Values;
+	TMap<int32, TCachedValue<vr::HmdMatrix34_t>> Matrix34Values;
+
+	FOpenVRDevicePropertySnapshot() :
+		bConnected(false),
+		DeviceClass(vr::ETrackedDeviceClass::TrackedDeviceClass_Invalid),
+		LastValidatedFrame(0),
+		LastRefreshTime(0.0)
+	{}
+
+	void Empty()
+	{
+		StringValues.Reset();
+		BoolValues.Reset();
+		FloatValues.Reset();
+		Int32Values.Reset();
+		UInt64Values.Reset();
+		Matrix34Values.Reset();
+	}
+};
+
+/**
+* Game thread cache of OpenVR tracked device properties.
+* A devices snapshot is dropped when the device is (de)activated or changes class, and otherwise every
+* vr.OpenVRDevicePropertyCacheInterval seconds. The runtime event queue belongs to the SteamVR HMD plugin so
+* activation is detected from the connected state / device class, InvalidateDevice can be called for anything else.
+*/
+class OPENVREXPANSIONPLUGIN_API FOpenVRDevicePropertyCache
+{
+public:
+
+	static FOpenVRDevicePropertyCache & Get();
+
+	// Converts one of our blueprint property enums to the OpenVR property, the lookup is only built once per enum
+	vr::ETrackedDeviceProperty GetPropertyEnum(const TCHAR * EnumName, uint8 Value);
+
+	bool GetStringProperty(vr::IVRSystem * VRSystem, int32 DeviceID, vr::ETrackedDeviceProperty Property, FString & OutValue);
+	bool GetBoolProperty(vr::IVRSystem * VRSystem, int32 DeviceID, vr::ETrackedDeviceProperty Property, bool & OutValue);
+	bool GetFloatProperty(vr::IVRSystem * VRSystem, int32 DeviceID, vr::ETrackedDeviceProperty Property, float & OutValue);
+	bool GetInt32Property(vr::IVRSystem * VRSystem, int32 DeviceID, vr::ETrackedDeviceProperty Property, int32 & OutValue);
+	bool GetUInt64Property(vr::IVRSystem * VRSystem, int32 DeviceID, vr::ETrackedDeviceProperty Property, uint64 & OutValue);
+	bool GetMatrix34Property(vr::IVRSystem * VRSystem, int32 DeviceID, vr::ETrackedDeviceProperty Property, vr::HmdMatrix34_t & OutValue);
+
+	// Returns the connected state and device class of the device, validated once per frame
+	bool IsDeviceConnected(vr::IVRSystem * VRSystem, int32 DeviceID, vr::ETrackedDeviceClass & OutDeviceClass);
+
+	// Drops the cached properties of a device, or all devices if DeviceID is INDEX_NONE
+	void InvalidateDevice(int32 DeviceID);
+
+private:
+
+	FOpenVRDevicePropertySnapshot * GetValidatedSnapshot(vr::IVRSystem * VRSystem, int32 DeviceID);
+
+	FOpenVRDevicePropertySnapshot Devices[vr::k_unMaxTrackedDeviceCount];
+	TMap<FString, TArray<vr::ETrackedDeviceProperty>> PropertyEnumLookup;
+};
+
+#endif // STEAMVR_SUPPORTED_PLATFORM
@@ -6,6 +6,7 @@
 #include "UObject/Object.h"
 #include "Engine/Texture.h"
 #include "Engine/EngineTypes.h"
+#include "Engine/LatentActionManager.h"
 //#include "EngineMinimal.h"
 #include "IMotionController.h"
 //#include "VRBPDatatypes.h"
@@ -419,6 +420,45 @@ enum class EVRDeviceProperty_Matrix34 : uint8
 	HMDProp_CameraToHeadTransform_Matrix34_2016		UMETA(DisplayName = "HMDProp_CameraToHeadTransform_Matrix34")
 };
 
+// Results of a batched device property query for a single device, values are in the same order as the requested properties
+USTRUCT(BlueprintType, Category = "VRExpansionFunctions|SteamVR")
+struct OPENVREXPANSIONPLUGIN_API FBPOpenVRDevicePropertySnapshot
+{
+	GENERATED_BODY()
+public:
+
+	UPROPERTY(BlueprintReadOnly, Category = "VRExpansionFunctions|SteamVR")
+		int32 DeviceID;
+
+	// False if any of the requested properties failed to be retrieved, failed values are left at their defaults
+	UPROPERTY(BlueprintReadOnly, Category = "VRExpansionFunctions|SteamVR")
+		bool bAllPropertiesSucceeded;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VRExpansionFunctions|SteamVR")
+		TArray<FString> StringValues;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VRExpansionFunctions|SteamVR")
+		TArray<bool> BoolValues;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VRExpansionFunctions|SteamVR")
+		TArray<float> FloatValues;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VRExpansionFunctions|SteamVR")
+		TArray<int32> Int32Values;
+
+	// As strings, blueprints do not support uint64
+	UPROPERTY(BlueprintReadOnly, Category = "VRExpansionFunctions|SteamVR")
+		TArray<FString> UInt64Values;
+
+	UPROPERTY(BlueprintReadOnly, Category = "VRExpansionFunctions|SteamVR")
+		TArray<FTransform> Matrix34Values;
+
+	FBPOpenVRDevicePropertySnapshot() :
+		DeviceID(-1),
+		bAllPropertiesSucceeded(false)
+	{}
+};
+
 // This needs to be updated as the original gets changed, that or hope they make the original blueprint accessible.
 UENUM(Blueprintable)
 enum class EBPOpenVRHMDDeviceType : uint8
@@ -515,6 +555,13 @@ public:
 	// Gets the model / texture of a SteamVR Device, can use to fill procedural mesh components or just get the texture of them to apply to a pre-made model.
 	UFUNCTION(BlueprintCallable, Category = "VRExpansionFunctions|SteamVR", meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", DisplayName = "GetVRDeviceModelAndTexture", ExpandEnumAsExecs = "Result", AdvancedDisplay = "OverrideDeviceID"))
 	static UTexture2D * GetVRDeviceModelAndTexture(UObject* WorldContextObject, EBPOpenVRTrackedDeviceClass DeviceType, TArray<UProceduralMeshComponent *> ProceduralMeshComponentsToFill, bool bCreateCollision, EAsyncBlueprintResultSwitch &Result, int32 OverrideDeviceID = -1);
+
+	// Latent version of GetVRDeviceModelAndTexture, the model is loaded once on a background task and shared with every other request for it.
+	UFUNCTION(BlueprintCallable, Category = "VRExpansionFunctions|SteamVR", meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", Latent, LatentInfo = "LatentInfo", DisplayName = "GetVRDeviceModelAndTextureAsync", AdvancedDisplay = "OverrideDeviceID"))
+	static void GetVRDeviceModelAndTextureAsync(UObject* WorldContextObject, FLatentActionInfo LatentInfo, EBPOpenVRTrackedDeviceClass DeviceType, TArray<UProceduralMeshComponent *> ProceduralMeshComponentsToFill, bool bCreateCollision, UTexture2D *& OutTexture, bool & bSucceeded, int32 OverrideDeviceID = -1);
+
+	// Gets the render model name of the first device of the type (or the override device)
+	static bool GetRenderModelNameForDevice(EBPOpenVRTrackedDeviceClass DeviceType, int32 OverrideDeviceID, FString & RenderModelName);
 	
 	// Gets a String device property
 	UFUNCTION(BlueprintCallable, Category = "VRExpansionFunctions|SteamVR", meta = (bIgnoreSelf = "true", DisplayName = "GetVRDevicePropertyString", ExpandEnumAsExecs = "Result"))
@@ -540,6 +587,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "VRExpansionFunctions|SteamVR", meta = (bIgnoreSelf = "true", DisplayName = "GetVRDevicePropertyMatrix34AsTransform", ExpandEnumAsExecs = "Result"))
 	static void GetVRDevicePropertyMatrix34AsTransform(EVRDeviceProperty_Matrix34 PropertyToRetrieve, int32 DeviceID, FTransform & TransformValue, EBPOVRResultSwitch & Result);
 
+	// Device property getters are served from a per device snapshot cache, refreshed when a device is (de)activated
+	// or after vr.OpenVRDevicePropertyCacheInterval seconds.
+
+	// Gets all of the requested properties for every connected device in one call
+	UFUNCTION(BlueprintCallable, Category = "VRExpansionFunctions|SteamVR", meta = (bIgnoreSelf = "true", DisplayName = "GetVRDevicePropertySnapshots", AutoCreateRefTerm = "StringProperties,BoolProperties,FloatProperties,Int32Properties,UInt64Properties,Matrix34Properties"))
+	static void GetVRDevicePropertySnapshots(const TArray<EVRDeviceProperty_String> & StringProperties, const TArray<EVRDeviceProperty_Bool> & BoolProperties, const TArray<EVRDeviceProperty_Float> & FloatProperties, const TArray<EVRDeviceProperty_Int32> & Int32Properties, const TArray<EVRDeviceProperty_UInt64> & UInt64Properties, const TArray<EVRDeviceProperty_Matrix34> & Matrix34Properties, TArray<FBPOpenVRDevicePropertySnapshot> & Snapshots);
+
+	// Forces the cached properties of a device (or all devices if -1) to be re-queried on next access
+	UFUNCTION(BlueprintCallable, Category = "VRExpansionFunctions|SteamVR", meta = (bIgnoreSelf = "true", DisplayName = "InvalidateVRDevicePropertyCache"))
+	static void InvalidateVRDevicePropertyCache(int32 DeviceID = -1);
+
 	// VR Camera options
 
 	// Returns if there is a VR camera and what its pixel height / width is
@@ -547,6 +605,7 @@ public:
 	static bool HasVRCamera(EOpenVRCameraFrameType FrameType, int32 &Width, int32 &Height);
 
 	// Gets a screen cap from the HMD camera if there is one
+	// Allocates a new frame buffer every call, use an OpenVRCameraFeed instead if pulling frames every tick
 	UFUNCTION(BlueprintCallable, Category = "VRExpansionFunctions|SteamVR|VRCamera", meta = (bIgnoreSelf = "true", DisplayName = "GetVRCameraFrame", ExpandEnumAsExecs = "Result"))
 	static void GetVRCameraFrame(UPARAM(ref) FBPOpenVRCameraHandle & CameraHandle, EOpenVRCameraFrameType FrameType, EBPOVRResultSwitch & Result, UTexture2D * TargetRenderTarget = nullptr);
 
@@ -0,0 +1,138 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+#include "Engine/LatentActionManager.h"
+#include "LatentActions.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "ProceduralMeshComponent.h"
+
+class UTexture2D;
+struct FOpenVRRenderModelPendingLoad;
+
+enum class EOpenVRRenderModelLoadState : int32
+{
+	Loading,
+	Loaded,
+	Failed
+};
+
+/**
+* A single render model as converted to UE4 space, shared between every requester of the same model name.
+* SteamVR is polled for the model on the game thread, the mesh and texel data is then converted on a background task.
+* The texture is created on the game thread the first time it is requested.
+*/
+struct OPENVREXPANSIONPLUGIN_API FOpenVRRenderModelEntry
+{
+	FString RenderModelName;
+
+	// Only read the data below once this is Loaded
+	FThreadSafeCounter LoadState;
+
+	TArray<FVector> Vertices;
+	TArray<int32> Triangles;
+	TArray<FVector> Normals;
+	TArray<FVector2D> UV0;
+
+	uint32 TextureWidth;
+	uint32 TextureHeight;
+	TArray<uint8> TextureData;
+
+	// Created once from TextureData on first request, held by the cache
+	UTexture2D * Texture;
+
+	// Platform time that the load failed at, game thread only
+	double FailedTime;
+
+	FOpenVRRenderModelEntry(const FString & InRenderModelName) :
+		RenderModelName(InRenderModelName),
+		LoadState((int32)EOpenVRRenderModelLoadState::Loading),
+		TextureWidth(0),
+		TextureHeight(0),
+		Texture(nullptr),
+		FailedTime(0.0)
+	{}
+
+	FORCEINLINE EOpenVRRenderModelLoadState GetLoadState() const
+	{
+		return (EOpenVRRenderModelLoadState)LoadState.GetValue();
+	}
+
+	// Game thread only, creates the shared texture if it has not been yet
+	UTexture2D * GetOrCreateTexture();
+
+	// Game thread only, fills the components from the shared mesh data
+	void FillProceduralMeshComponents(UObject* WorldContextObject, const TArray<UProceduralMeshComponent *> & ProceduralMeshComponentsToFill, bool bCreateCollision) const;
+};
+
+/**
+* Cache of SteamVR render models keyed by render model name.
+* Models are loaded and converted once and then shared with all callers, failed loads are kept so that callers see the failure.
+*/
+class OPENVREXPANSIONPLUGIN_API FOpenVRRenderModelCache : public FGCObject
+{
+public:
+
+	virtual ~FOpenVRRenderModelCache();
+
+	static FOpenVRRenderModelCache & Get();
+
+	// Called on module shutdown
+	static void Shutdown();
+
+	// Returns the cached entry for the model, starting the load if it isn't loaded or loading yet.
+	// A failed entry is returned as is until the retry cooldown has passed, unless bRetryFailed is set.
+	TSharedPtr<FOpenVRRenderModelEntry, ESPMode::ThreadSafe> FindOrLoad(const FString & RenderModelName, bool bRetryFailed = false);
+
+	// Drops all cached models, in flight loads will finish into their orphaned entries
+	void Empty();
+
+	// FGCObject interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+
+private:
+
+	TMap<FString, TSharedPtr<FOpenVRRenderModelEntry, ESPMode::ThreadSafe>> CachedModels;
+
+	// Loads still waiting on SteamVR or their conversion, polled from the core ticker
+	TArray<TSharedPtr<FOpenVRRenderModelPendingLoad>> PendingLoads;
+	FDelegateHandle TickerHandle;
+
+	bool Tick(float DeltaTime);
+
+	// Returns true once the load is finished, either way
+	static bool UpdatePendingLoad(FOpenVRRenderModelPendingLoad & PendingLoad);
+};
+
+/**
+* Latent action that waits for a cached render model to finish loading and then fills the requesters outputs.
+*/
+class FOpenVRRenderModelLatentAction : public FPendingLatentAction
+{
+public:
+
+	TSharedPtr<FOpenVRRenderModelEntry, ESPMode::ThreadSafe> Entry;
+	TWeakObjectPtr<UObject> WorldContextObject;
+	TArray<TWeakObjectPtr<UProceduralMeshComponent>> ProceduralMeshComponentsToFill;
+	bool bCreateCollision;
+
+	UTexture2D *& OutTexture;
+	bool & bSucceeded;
+
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+
+	FOpenVRRenderModelLatentAction(TSharedPtr<FOpenVRRenderModelEntry, ESPMode::ThreadSafe> InEntry, UObject* InWorldContextObject, const TArray<UProceduralMeshComponent *> & InComponents, bool bInCreateCollision, UTexture2D *& InOutTexture, bool & bInSucceeded, const FLatentActionInfo& LatentInfo);
+
+	virtual void UpdateOperation(FLatentResponse& Response) override;
+
+#if WITH_EDITOR
+	virtual FString GetDescription() const override
+	{
+		return FString::Printf(TEXT("Loading render model %s"), Entry.IsValid() ? *Entry->RenderModelName : TEXT("None"));
+	}
+#endif
+};
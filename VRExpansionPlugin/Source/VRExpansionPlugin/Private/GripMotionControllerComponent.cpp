@@ -38,6 +38,8 @@ DEFINE_LOG_CATEGORY(LogVRMotionController);
 //For UE4 Profiler ~ Stat
 DECLARE_CYCLE_STAT(TEXT("TickGrip ~ TickingGrip"), STAT_TickGrip, STATGROUP_TickGrip);
 DECLARE_CYCLE_STAT(TEXT("GetGripWorldTransform ~ GettingTransform"), STAT_GetGripTransform, STATGROUP_TickGrip);
+DECLARE_CYCLE_STAT(TEXT("FlushTeleportMoves ~ BatchedTeleport"), STAT_TeleportGrips, STATGROUP_TickGrip);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Grips Teleported"), STAT_TeleportGripsMoved, STATGROUP_TickGrip);
 
 // MAGIC NUMBERS
 // Constraint multipliers for angular, to avoid having to have two sets of stiffness/damping variables
@@ -64,6 +66,14 @@ namespace GripMotionControllerCvars
 		TEXT("When on, will draw debug speheres for physics grips COM.\n")
 		TEXT("0: Disable, 1: Enable"),
 		ECVF_Default);
+
+	static int32 bBatchGripTeleports = 1;
+	FAutoConsoleVariableRef CVarBatchGripTeleports(
+		TEXT("vre.BatchGripTeleports"),
+		bBatchGripTeleports,
+		TEXT("When on, the post teleport moves of all of a controllers grips are applied together at the end of its grip tick, locking each physics scene once.\n")
+		TEXT("0: Teleport each grip as it is ticked"),
+		ECVF_Default);
 }
 
   //=============================================================================
@@ -186,28 +196,29 @@ void UGripMotionControllerComponent::OnUnregister()
 		}
 	}
 
-	for (int i = 0; i < GrippedObjects.Num(); i++)
+	for (int i = 0; i < GrippedObjects.Grips.Num(); i++)
 	{
-		DestroyPhysicsHandle(GrippedObjects[i]);
+		DestroyPhysicsHandle(GrippedObjects.Grips[i]);
 
-		DropObjectByInterface(GrippedObjects[i].GrippedObject);
+		DropObjectByInterface(GrippedObjects.Grips[i].GrippedObject);
 		//DropObject(GrippedObjects[i].GrippedObject, false);	
 	}
-	GrippedObjects.Empty();
+	GrippedObjects.EmptyGrips();
 
-	for (int i = 0; i < LocallyGrippedObjects.Num(); i++)
+	for (int i = 0; i < LocallyGrippedObjects.Grips.Num(); i++)
 	{
-		DestroyPhysicsHandle(LocallyGrippedObjects[i]);
-		DropObjectByInterface(LocallyGrippedObjects[i].GrippedObject);
+		DestroyPhysicsHandle(LocallyGrippedObjects.Grips[i]);
+		DropObjectByInterface(LocallyGrippedObjects.Grips[i].GrippedObject);
 		//DropObject(LocallyGrippedObjects[i].GrippedObject, false);
 	}
-	LocallyGrippedObjects.Empty();
+	LocallyGrippedObjects.EmptyGrips();
 
 	for (int i = 0; i < PhysicsGrips.Num(); i++)
 	{
 		DestroyPhysicsHandle(PhysicsGrips[i].SceneIndex, &PhysicsGrips[i].HandleData, &PhysicsGrips[i].KinActorData);
 	}
 	PhysicsGrips.Empty();
+	MarkGripIndexDirty();
 
 	Super::OnUnregister();
 }
@@ -244,6 +255,13 @@ void UGripMotionControllerComponent::CreateRenderState_Concurrent()
 
 void UGripMotionControllerComponent::SendRenderTransform_Concurrent()
 {
+	// Only the late update path reads these, which never runs on an optimized server
+	if (UVRGlobalSettings::IsServerOptimized())
+	{
+		Super::SendRenderTransform_Concurrent();
+		return;
+	}
+
 	GripRenderThreadRelativeTransform = GetRelativeTransform();
 	GripRenderThreadComponentScale = GetComponentScale();
 	GripRenderThreadProfileTransform = CurrentControllerProfileTransform;
@@ -253,19 +271,19 @@ void UGripMotionControllerComponent::SendRenderTransform_Concurrent()
 
 FBPActorPhysicsHandleInformation * UGripMotionControllerComponent::GetPhysicsGrip(const FBPActorGripInformation & GripInfo)
 {
-	return PhysicsGrips.FindByKey(GripInfo);
+	return PhysicsGripsIndex.Find(PhysicsGrips, GripInfo.GripID);
 }
 
 
 bool UGripMotionControllerComponent::GetPhysicsGripIndex(const FBPActorGripInformation & GripInfo, int & index)
 {
-	index = PhysicsGrips.IndexOfByKey(GripInfo);
+	index = PhysicsGripsIndex.IndexOf(PhysicsGrips, GripInfo.GripID);
 	return index != INDEX_NONE;
 }
 
 FBPActorPhysicsHandleInformation * UGripMotionControllerComponent::CreatePhysicsGrip(const FBPActorGripInformation & GripInfo)
 {
-	FBPActorPhysicsHandleInformation * HandleInfo = PhysicsGrips.FindByKey(GripInfo);
+	FBPActorPhysicsHandleInformation * HandleInfo = PhysicsGripsIndex.Find(PhysicsGrips, GripInfo.GripID);
 
 	if (HandleInfo)
 	{
@@ -278,10 +296,19 @@ FBPActorPhysicsHandleInformation * UGripMotionControllerComponent::CreatePhysics
 	NewInfo.GripID = GripInfo.GripID;
 
 	int index = PhysicsGrips.Add(NewInfo);
+	PhysicsGripsIndex.NotifyAdded(PhysicsGrips, index);
 
 	return &PhysicsGrips[index];
 }
 
+void UGripMotionControllerComponent::RemovePhysicsGripAt(int32 Index)
+{
+	const uint8 GripID = PhysicsGrips[Index].GripID;
+	const UObject * HandledObject = PhysicsGrips[Index].HandledObject;
+	PhysicsGrips.RemoveAt(Index);
+	PhysicsGripsIndex.NotifyRemoved(PhysicsGrips, Index, GripID, HandledObject);
+}
+
 
 //=============================================================================
 void UGripMotionControllerComponent::GetLifetimeReplicatedProps(TArray< class FLifetimeProperty > & OutLifetimeProps) const
@@ -361,9 +388,9 @@ void UGripMotionControllerComponent::GetGripByActor(FBPActorGripInformation &Gri
 		return;
 	}
 
-	FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(ActorToLookForGrip);
+	FBPActorGripInformation * GripInfo = FindReplicatedGrip(ActorToLookForGrip);
 	if(!GripInfo)
-		GripInfo = LocallyGrippedObjects.FindByKey(ActorToLookForGrip);
+		GripInfo = FindLocalGrip(ActorToLookForGrip);
 	
 	if (GripInfo)
 	{
@@ -383,9 +410,9 @@ void UGripMotionControllerComponent::GetGripByComponent(FBPActorGripInformation
 		return;
 	}
 
-	FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(ComponentToLookForGrip);
+	FBPActorGripInformation * GripInfo = FindReplicatedGrip(ComponentToLookForGrip);
 	if(!GripInfo)
-		GripInfo = LocallyGrippedObjects.FindByKey(ComponentToLookForGrip);
+		GripInfo = FindLocalGrip(ComponentToLookForGrip);
 
 	if (GripInfo)
 	{
@@ -405,9 +432,9 @@ void UGripMotionControllerComponent::GetGripByObject(FBPActorGripInformation &Gr
 		return;
 	}
 
-	FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(ObjectToLookForGrip);
+	FBPActorGripInformation * GripInfo = FindReplicatedGrip(ObjectToLookForGrip);
 	if(!GripInfo)
-		GripInfo = LocallyGrippedObjects.FindByKey(ObjectToLookForGrip);
+		GripInfo = FindLocalGrip(ObjectToLookForGrip);
 
 	if (GripInfo)
 	{
@@ -427,9 +454,9 @@ void UGripMotionControllerComponent::GetGripByID(FBPActorGripInformation &Grip,
 		return;
 	}
 
-	FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(IDToLookForGrip);
+	FBPActorGripInformation * GripInfo = FindReplicatedGrip(IDToLookForGrip);
 	if (!GripInfo)
-		GripInfo = LocallyGrippedObjects.FindByKey(IDToLookForGrip);
+		GripInfo = FindLocalGrip(IDToLookForGrip);
 
 	if (GripInfo)
 	{
@@ -443,21 +470,21 @@ void UGripMotionControllerComponent::GetGripByID(FBPActorGripInformation &Grip,
 
 void UGripMotionControllerComponent::SetGripPaused(const FBPActorGripInformation &Grip, EBPVRResultSwitch &Result, bool bIsPaused, bool bNoConstraintWhenPaused)
 {
-	int fIndex = GrippedObjects.Find(Grip);
+	int fIndex = GrippedObjects.Grips.Find(Grip);
 
 	FBPActorGripInformation * GripInformation = nullptr;
 
 	if (fIndex != INDEX_NONE)
 	{
-		GripInformation = &GrippedObjects[fIndex];
+		GripInformation = &GrippedObjects.Grips[fIndex];
 	}
 	else
 	{
-		fIndex = LocallyGrippedObjects.Find(Grip);
+		fIndex = LocallyGrippedObjects.Grips.Find(Grip);
 
 		if (fIndex != INDEX_NONE)
 		{
-			GripInformation = &LocallyGrippedObjects[fIndex];
+			GripInformation = &LocallyGrippedObjects.Grips[fIndex];
 		}
 	}
 
@@ -491,19 +518,19 @@ void UGripMotionControllerComponent::SetPausedTransform(const FBPActorGripInform
 
 	FBPActorGripInformation * GripInformation = nullptr;
 
-	int fIndex = GrippedObjects.Find(Grip);
+	int fIndex = GrippedObjects.Grips.Find(Grip);
 
 	if (fIndex != INDEX_NONE)
 	{
-		GripInformation = &GrippedObjects[fIndex];
+		GripInformation = &GrippedObjects.Grips[fIndex];
 	}
 	else
 	{
-		fIndex = LocallyGrippedObjects.Find(Grip);
+		fIndex = LocallyGrippedObjects.Grips.Find(Grip);
 
 		if (fIndex != INDEX_NONE)
 		{
-			GripInformation = &LocallyGrippedObjects[fIndex];
+			GripInformation = &LocallyGrippedObjects.Grips[fIndex];
 		}
 	}
 	
@@ -516,7 +543,7 @@ void UGripMotionControllerComponent::SetPausedTransform(const FBPActorGripInform
 		}
 		else
 		{
-			if (FBPActorPhysicsHandleInformation * PhysHandle = GetPhysicsGrip(GrippedObjects[fIndex]))
+			if (FBPActorPhysicsHandleInformation * PhysHandle = GetPhysicsGrip(GrippedObjects.Grips[fIndex]))
 			{
 				UpdatePhysicsHandleTransform(*GripInformation, PausedTransform);
 			}
@@ -540,27 +567,29 @@ void UGripMotionControllerComponent::SetPausedTransform(const FBPActorGripInform
 
 void UGripMotionControllerComponent::SetGripCollisionType(const FBPActorGripInformation &Grip, EBPVRResultSwitch &Result, EGripCollisionType NewGripCollisionType)
 {
-	int fIndex = GrippedObjects.Find(Grip);
+	int fIndex = GrippedObjects.Grips.Find(Grip);
 
 	if (fIndex != INDEX_NONE)
 	{
-		GrippedObjects[fIndex].GripCollisionType = NewGripCollisionType;
-		ReCreateGrip(GrippedObjects[fIndex]);
+		GrippedObjects.Grips[fIndex].GripCollisionType = NewGripCollisionType;
+		GrippedObjects.MarkItemDirty(GrippedObjects.Grips[fIndex]);
+		ReCreateGrip(GrippedObjects.Grips[fIndex]);
 		Result = EBPVRResultSwitch::OnSucceeded;
 		return;
 	}
 	else
 	{
-		fIndex = LocallyGrippedObjects.Find(Grip);
+		fIndex = LocallyGrippedObjects.Grips.Find(Grip);
 
 		if (fIndex != INDEX_NONE)
 		{
-			LocallyGrippedObjects[fIndex].GripCollisionType = NewGripCollisionType;
+			LocallyGrippedObjects.Grips[fIndex].GripCollisionType = NewGripCollisionType;
+			LocallyGrippedObjects.MarkItemDirty(LocallyGrippedObjects.Grips[fIndex]);
 
-			if (GetNetMode() == ENetMode::NM_Client && !IsTornOff() && LocallyGrippedObjects[fIndex].GripMovementReplicationSetting == EGripMovementReplicationSettings::ClientSide_Authoritive)
-				Server_NotifyLocalGripAddedOrChanged(LocallyGrippedObjects[fIndex]);
+			if (GetNetMode() == ENetMode::NM_Client && !IsTornOff() && LocallyGrippedObjects.Grips[fIndex].GripMovementReplicationSetting == EGripMovementReplicationSettings::ClientSide_Authoritive)
+				Server_NotifyLocalGripAddedOrChanged(LocallyGrippedObjects.Grips[fIndex]);
 
-			ReCreateGrip(LocallyGrippedObjects[fIndex]);
+			ReCreateGrip(LocallyGrippedObjects.Grips[fIndex]);
 
 			Result = EBPVRResultSwitch::OnSucceeded;
 			return;
@@ -572,24 +601,26 @@ void UGripMotionControllerComponent::SetGripCollisionType(const FBPActorGripInfo
 
 void UGripMotionControllerComponent::SetGripLateUpdateSetting(const FBPActorGripInformation &Grip, EBPVRResultSwitch &Result, EGripLateUpdateSettings NewGripLateUpdateSetting)
 {
-	int fIndex = GrippedObjects.Find(Grip);
+	int fIndex = GrippedObjects.Grips.Find(Grip);
 
 	if (fIndex != INDEX_NONE)
 	{
-		GrippedObjects[fIndex].GripLateUpdateSetting = NewGripLateUpdateSetting;
+		GrippedObjects.Grips[fIndex].GripLateUpdateSetting = NewGripLateUpdateSetting;
+		GrippedObjects.MarkItemDirty(GrippedObjects.Grips[fIndex]);
 		Result = EBPVRResultSwitch::OnSucceeded;
 		return;
 	}
 	else
 	{
-		fIndex = LocallyGrippedObjects.Find(Grip);
+		fIndex = LocallyGrippedObjects.Grips.Find(Grip);
 
 		if (fIndex != INDEX_NONE)
 		{
-			LocallyGrippedObjects[fIndex].GripLateUpdateSetting = NewGripLateUpdateSetting;
+			LocallyGrippedObjects.Grips[fIndex].GripLateUpdateSetting = NewGripLateUpdateSetting;
+			LocallyGrippedObjects.MarkItemDirty(LocallyGrippedObjects.Grips[fIndex]);
 
-			if (GetNetMode() == ENetMode::NM_Client && !IsTornOff() && LocallyGrippedObjects[fIndex].GripMovementReplicationSetting == EGripMovementReplicationSettings::ClientSide_Authoritive)
-				Server_NotifyLocalGripAddedOrChanged(LocallyGrippedObjects[fIndex]);
+			if (GetNetMode() == ENetMode::NM_Client && !IsTornOff() && LocallyGrippedObjects.Grips[fIndex].GripMovementReplicationSetting == EGripMovementReplicationSettings::ClientSide_Authoritive)
+				Server_NotifyLocalGripAddedOrChanged(LocallyGrippedObjects.Grips[fIndex]);
 
 			Result = EBPVRResultSwitch::OnSucceeded;
 			return;
@@ -605,24 +636,26 @@ void UGripMotionControllerComponent::SetGripRelativeTransform(
 	const FTransform & NewRelativeTransform
 	)
 {
-	int fIndex = GrippedObjects.Find(Grip);
+	int fIndex = GrippedObjects.Grips.Find(Grip);
 
 	if (fIndex != INDEX_NONE)
 	{
-		GrippedObjects[fIndex].RelativeTransform = NewRelativeTransform;
+		GrippedObjects.Grips[fIndex].RelativeTransform = NewRelativeTransform;
+		GrippedObjects.MarkItemDirty(GrippedObjects.Grips[fIndex]);
 		Result = EBPVRResultSwitch::OnSucceeded;
 		return;
 	}
 	else
 	{
-		fIndex = LocallyGrippedObjects.Find(Grip);
+		fIndex = LocallyGrippedObjects.Grips.Find(Grip);
 
 		if (fIndex != INDEX_NONE)
 		{
-			LocallyGrippedObjects[fIndex].RelativeTransform = NewRelativeTransform;
+			LocallyGrippedObjects.Grips[fIndex].RelativeTransform = NewRelativeTransform;
+			LocallyGrippedObjects.MarkItemDirty(LocallyGrippedObjects.Grips[fIndex]);
 
-			if (GetNetMode() == ENetMode::NM_Client && !IsTornOff() && LocallyGrippedObjects[fIndex].GripMovementReplicationSetting == EGripMovementReplicationSettings::ClientSide_Authoritive)
-				Server_NotifyLocalGripAddedOrChanged(LocallyGrippedObjects[fIndex]);
+			if (GetNetMode() == ENetMode::NM_Client && !IsTornOff() && LocallyGrippedObjects.Grips[fIndex].GripMovementReplicationSetting == EGripMovementReplicationSettings::ClientSide_Authoritive)
+				Server_NotifyLocalGripAddedOrChanged(LocallyGrippedObjects.Grips[fIndex]);
 
 			Result = EBPVRResultSwitch::OnSucceeded;
 			return;
@@ -638,22 +671,22 @@ void UGripMotionControllerComponent::SetGripAdditionTransform(
 	const FTransform & NewAdditionTransform, bool bMakeGripRelative
 	)
 {
-	int fIndex = GrippedObjects.Find(Grip);
+	int fIndex = GrippedObjects.Grips.Find(Grip);
 
 	if (fIndex != INDEX_NONE)
 	{
-		GrippedObjects[fIndex].AdditionTransform = CreateGripRelativeAdditionTransform(Grip, NewAdditionTransform, bMakeGripRelative);
+		GrippedObjects.Grips[fIndex].AdditionTransform = CreateGripRelativeAdditionTransform(Grip, NewAdditionTransform, bMakeGripRelative);
 
 		Result = EBPVRResultSwitch::OnSucceeded;
 		return;
 	}
 	else
 	{
-		fIndex = LocallyGrippedObjects.Find(Grip);
+		fIndex = LocallyGrippedObjects.Grips.Find(Grip);
 
 		if (fIndex != INDEX_NONE)
 		{
-			LocallyGrippedObjects[fIndex].AdditionTransform = CreateGripRelativeAdditionTransform(Grip, NewAdditionTransform, bMakeGripRelative);
+			LocallyGrippedObjects.Grips[fIndex].AdditionTransform = CreateGripRelativeAdditionTransform(Grip, NewAdditionTransform, bMakeGripRelative);
 
 			Result = EBPVRResultSwitch::OnSucceeded;
 			return;
@@ -669,43 +702,47 @@ void UGripMotionControllerComponent::SetGripStiffnessAndDamping(
 	)
 {
 	Result = EBPVRResultSwitch::OnFailed;
-	int fIndex = GrippedObjects.Find(Grip);
+	int fIndex = GrippedObjects.Grips.Find(Grip);
 
 	if (fIndex != INDEX_NONE)
 	{
-		GrippedObjects[fIndex].Stiffness = NewStiffness;
-		GrippedObjects[fIndex].Damping = NewDamping;
+		GrippedObjects.Grips[fIndex].Stiffness = NewStiffness;
+		GrippedObjects.Grips[fIndex].Damping = NewDamping;
 
 		if (bAlsoSetAngularValues)
 		{
-			GrippedObjects[fIndex].AdvancedGripSettings.PhysicsSettings.AngularStiffness = OptionalAngularStiffness;
-			GrippedObjects[fIndex].AdvancedGripSettings.PhysicsSettings.AngularDamping = OptionalAngularDamping;
+			GrippedObjects.Grips[fIndex].AdvancedGripSettings.PhysicsSettings.AngularStiffness = OptionalAngularStiffness;
+			GrippedObjects.Grips[fIndex].AdvancedGripSettings.PhysicsSettings.AngularDamping = OptionalAngularDamping;
 		}
 
+		GrippedObjects.MarkItemDirty(GrippedObjects.Grips[fIndex]);
+
 		Result = EBPVRResultSwitch::OnSucceeded;
-		SetGripConstraintStiffnessAndDamping(&GrippedObjects[fIndex]);
+		SetGripConstraintStiffnessAndDamping(&GrippedObjects.Grips[fIndex]);
 		//return;
 	}
 	else
 	{
-		fIndex = LocallyGrippedObjects.Find(Grip);
+		fIndex = LocallyGrippedObjects.Grips.Find(Grip);
 
 		if (fIndex != INDEX_NONE)
 		{
-			LocallyGrippedObjects[fIndex].Stiffness = NewStiffness;
-			LocallyGrippedObjects[fIndex].Damping = NewDamping;
+			LocallyGrippedObjects.Grips[fIndex].Stiffness = NewStiffness;
+			LocallyGrippedObjects.Grips[fIndex].Damping = NewDamping;
 
 			if (bAlsoSetAngularValues)
 			{
-				LocallyGrippedObjects[fIndex].AdvancedGripSettings.PhysicsSettings.AngularStiffness = OptionalAngularStiffness;
-				LocallyGrippedObjects[fIndex].AdvancedGripSettings.PhysicsSettings.AngularDamping = OptionalAngularDamping;
+				LocallyGrippedObjects.Grips[fIndex].AdvancedGripSettings.PhysicsSettings.AngularStiffness = OptionalAngularStiffness;
+				LocallyGrippedObjects.Grips[fIndex].AdvancedGripSettings.PhysicsSettings.AngularDamping = OptionalAngularDamping;
 			}
 
-			if (GetNetMode() == ENetMode::NM_Client && !IsTornOff() && LocallyGrippedObjects[fIndex].GripMovementReplicationSetting == EGripMovementReplicationSettings::ClientSide_Authoritive)
-				Server_NotifyLocalGripAddedOrChanged(LocallyGrippedObjects[fIndex]);
+			LocallyGrippedObjects.MarkItemDirty(LocallyGrippedObjects.Grips[fIndex]);
+
+			if (GetNetMode() == ENetMode::NM_Client && !IsTornOff() && LocallyGrippedObjects.Grips[fIndex].GripMovementReplicationSetting == EGripMovementReplicationSettings::ClientSide_Authoritive)
+				Server_NotifyLocalGripAddedOrChanged(LocallyGrippedObjects.Grips[fIndex]);
 
 			Result = EBPVRResultSwitch::OnSucceeded;
-			SetGripConstraintStiffnessAndDamping(&LocallyGrippedObjects[fIndex]);
+			SetGripConstraintStiffnessAndDamping(&LocallyGrippedObjects.Grips[fIndex]);
 		//	return;
 		}
 	}
@@ -720,6 +757,39 @@ FTransform UGripMotionControllerComponent::CreateGripRelativeAdditionTransform_B
 	return CreateGripRelativeAdditionTransform(GripToSample, AdditionTransform, bGripRelative);
 }
 
+void UGripMotionControllerComponent::MarkGripDirty(FBPActorGripInformation & Grip)
+{
+	if (GrippedObjects.OwnsGrip(Grip))
+		GrippedObjects.MarkItemDirty(Grip);
+	else if (LocallyGrippedObjects.OwnsGrip(Grip))
+		LocallyGrippedObjects.MarkItemDirty(Grip);
+}
+
+void UGripMotionControllerComponent::HandlePendingGripReplication(FBPActorGripArray & GripArray)
+{
+	// Grips that were only changed keep their slots
+	TVRGripIndex<FBPActorGripInformation> & GripIndex = (&GripArray == &GrippedObjects) ? GrippedObjectsIndex : LocallyGrippedObjectsIndex;
+	if (GripArray.bPendingRepLayoutChange)
+		GripIndex.MarkDirty();
+	else
+		GripIndex.MarkUnverified();
+
+	GripArray.bPendingRepLayoutChange = false;
+
+	// Only the grips that the delta touched, in the order they came in
+	TArray<uint8> PendingGripIDs = MoveTemp(GripArray.PendingRepGripIDs);
+
+	for (uint8 GripID : PendingGripIDs)
+	{
+		FBPActorGripInformation * GripInfo = GripIndex.Find(GripArray.Grips, GripID);
+
+		if (GripInfo)
+		{
+			HandleGripReplication(*GripInfo);
+		}
+	}
+}
+
 bool UGripMotionControllerComponent::HandleGripReplication(FBPActorGripInformation & Grip)
 {
 	if (Grip.ValueCache.bWasInitiallyRepped && Grip.GripID != Grip.ValueCache.CachedGripID)
@@ -736,8 +806,9 @@ bool UGripMotionControllerComponent::HandleGripReplication(FBPActorGripInformati
 		// skip init
 		Grip.ValueCache.bWasInitiallyRepped = true;
 
-		// null ptr so this doesn't block grip operations
+		// null ptr so this doesn't block grip operations, the stale object slot fails its check and rebuilds
 		Grip.GrippedObject = nullptr;
+		(LocallyGrippedObjects.OwnsGrip(Grip) ? LocallyGrippedObjectsIndex : GrippedObjectsIndex).MarkUnverified();
 
 		// Set to paused so iteration skips it
 		Grip.bIsPaused = true;
@@ -894,9 +965,9 @@ bool UGripMotionControllerComponent::DropObject(
 
 	if (ObjectToDrop != nullptr)
 	{
-		FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(ObjectToDrop);
+		FBPActorGripInformation * GripInfo = FindReplicatedGrip(ObjectToDrop);
 		if (!GripInfo)
-			GripInfo = LocallyGrippedObjects.FindByKey(ObjectToDrop);
+			GripInfo = FindLocalGrip(ObjectToDrop);
 
 		if (GripInfo != nullptr)
 		{
@@ -905,9 +976,9 @@ bool UGripMotionControllerComponent::DropObject(
 	}
 	else if (GripIDToDrop != INVALID_VRGRIP_ID)
 	{
-		FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(GripIDToDrop);
+		FBPActorGripInformation * GripInfo = FindReplicatedGrip(GripIDToDrop);
 		if (!GripInfo)
-			GripInfo = LocallyGrippedObjects.FindByKey(GripIDToDrop);
+			GripInfo = FindLocalGrip(GripIDToDrop);
 
 		if (GripInfo != nullptr)
 		{
@@ -1027,15 +1098,15 @@ bool UGripMotionControllerComponent::DropObjectByInterface(UObject * ObjectToDro
 	FBPActorGripInformation * GripInfo = nullptr;
 	if (ObjectToDrop != nullptr)
 	{
-		GripInfo = GrippedObjects.FindByKey(ObjectToDrop);
+		GripInfo = FindReplicatedGrip(ObjectToDrop);
 		if (!GripInfo)
-			GripInfo = LocallyGrippedObjects.FindByKey(ObjectToDrop);
+			GripInfo = FindLocalGrip(ObjectToDrop);
 	}
 	else if (GripIDToDrop != INVALID_VRGRIP_ID)
 	{
-		GripInfo = GrippedObjects.FindByKey(GripIDToDrop);
+		GripInfo = FindReplicatedGrip(GripIDToDrop);
 		if (!GripInfo)
-			GripInfo = LocallyGrippedObjects.FindByKey(GripIDToDrop);
+			GripInfo = FindLocalGrip(GripIDToDrop);
 	}
 
 	if (GripInfo == nullptr)
@@ -1247,19 +1318,19 @@ bool UGripMotionControllerComponent::GripActor(
 
 	if (!bIsLocalGrip)
 	{
-		int32 Index = GrippedObjects.Add(newActorGrip);
+		int32 Index = AddReplicatedGrip(newActorGrip);
 		if(Index != INDEX_NONE)
-			NotifyGrip(GrippedObjects[Index]);
+			NotifyGrip(GrippedObjects.Grips[Index]);
 	}
 	else
 	{
-		int32 Index = LocallyGrippedObjects.Add(newActorGrip);
+		int32 Index = AddLocalGrip(newActorGrip);
 
 		if(GetNetMode() == ENetMode::NM_Client && !IsTornOff() && newActorGrip.GripMovementReplicationSetting == EGripMovementReplicationSettings::ClientSide_Authoritive)
 			Server_NotifyLocalGripAddedOrChanged(newActorGrip);
 
 		if (Index != INDEX_NONE)
-			NotifyGrip(LocallyGrippedObjects[Index]);
+			NotifyGrip(LocallyGrippedObjects.Grips[Index]);
 	}
 
 	return true;
@@ -1273,7 +1344,7 @@ bool UGripMotionControllerComponent::DropActor(AActor* ActorToDrop, bool bSimula
 		return false;
 	}
 
-	FBPActorGripInformation * GripToDrop = LocallyGrippedObjects.FindByKey(ActorToDrop);
+	FBPActorGripInformation * GripToDrop = FindLocalGrip(ActorToDrop);
 
 	if(GripToDrop)
 		return DropGrip(*GripToDrop, bSimulate, OptionalAngularVelocity, OptionalLinearVelocity);
@@ -1284,7 +1355,7 @@ bool UGripMotionControllerComponent::DropActor(AActor* ActorToDrop, bool bSimula
 		return false;
 	}
 
-	GripToDrop = GrippedObjects.FindByKey(ActorToDrop);
+	GripToDrop = FindReplicatedGrip(ActorToDrop);
 	if (GripToDrop)
 		return DropGrip(*GripToDrop, bSimulate, OptionalAngularVelocity, OptionalLinearVelocity);
 
@@ -1441,19 +1512,19 @@ bool UGripMotionControllerComponent::GripComponent(
 
 	if (!bIsLocalGrip)
 	{
-		int32 Index = GrippedObjects.Add(newActorGrip);
+		int32 Index = AddReplicatedGrip(newActorGrip);
 		if (Index != INDEX_NONE)
-			NotifyGrip(GrippedObjects[Index]);
+			NotifyGrip(GrippedObjects.Grips[Index]);
 	}
 	else
 	{
-		int32 Index = LocallyGrippedObjects.Add(newActorGrip);
+		int32 Index = AddLocalGrip(newActorGrip);
 
 		if (GetNetMode() == ENetMode::NM_Client && !IsTornOff() && newActorGrip.GripMovementReplicationSetting == EGripMovementReplicationSettings::ClientSide_Authoritive)
 			Server_NotifyLocalGripAddedOrChanged(newActorGrip);
 
 		if (Index != INDEX_NONE)
-			NotifyGrip(LocallyGrippedObjects[Index]);
+			NotifyGrip(LocallyGrippedObjects.Grips[Index]);
 	}
 
 	return true;
@@ -1465,7 +1536,7 @@ bool UGripMotionControllerComponent::DropComponent(UPrimitiveComponent * Compone
 	FBPActorGripInformation *GripInfo;
 	
 	// First check for it in the local grips	
-	GripInfo = LocallyGrippedObjects.FindByKey(ComponentToDrop);
+	GripInfo = FindLocalGrip(ComponentToDrop);
 
 	if (GripInfo != nullptr)
 	{
@@ -1480,7 +1551,7 @@ bool UGripMotionControllerComponent::DropComponent(UPrimitiveComponent * Compone
 	}
 
 	// Now check in the server auth gripsop)
-	GripInfo = GrippedObjects.FindByKey(ComponentToDrop);
+	GripInfo = FindReplicatedGrip(ComponentToDrop);
 
 	if (GripInfo != nullptr)
 	{
@@ -1499,7 +1570,7 @@ bool UGripMotionControllerComponent::DropGrip(const FBPActorGripInformation &Gri
 {
 	int FoundIndex = 0;
 	bool bWasLocalGrip = false;
-	if (!LocallyGrippedObjects.Find(Grip, FoundIndex)) // This auto checks if Actor and Component are valid in the == operator
+	if (!LocallyGrippedObjects.Grips.Find(Grip, FoundIndex)) // This auto checks if Actor and Component are valid in the == operator
 	{
 		if (!IsServer())
 		{
@@ -1507,7 +1578,7 @@ bool UGripMotionControllerComponent::DropGrip(const FBPActorGripInformation &Gri
 			return false;
 		}
 
-		if (!GrippedObjects.Find(Grip, FoundIndex)) // This auto checks if Actor and Component are valid in the == operator
+		if (!GrippedObjects.Grips.Find(Grip, FoundIndex)) // This auto checks if Actor and Component are valid in the == operator
 		{
 			UE_LOG(LogVRMotionController, Warning, TEXT("VRGripMotionController drop function was passed an invalid drop"));
 			return false;
@@ -1524,13 +1595,13 @@ bool UGripMotionControllerComponent::DropGrip(const FBPActorGripInformation &Gri
 	AActor * pActor = nullptr;
 	if (bWasLocalGrip)
 	{
-		PrimComp = LocallyGrippedObjects[FoundIndex].GetGrippedComponent();
-		pActor = LocallyGrippedObjects[FoundIndex].GetGrippedActor();
+		PrimComp = LocallyGrippedObjects.Grips[FoundIndex].GetGrippedComponent();
+		pActor = LocallyGrippedObjects.Grips[FoundIndex].GetGrippedActor();
 	}
 	else
 	{
-		PrimComp = GrippedObjects[FoundIndex].GetGrippedComponent();
-		pActor = GrippedObjects[FoundIndex].GetGrippedActor();
+		PrimComp = GrippedObjects.Grips[FoundIndex].GetGrippedComponent();
+		pActor = GrippedObjects.Grips[FoundIndex].GetGrippedActor();
 	}
 
 	if (!PrimComp && pActor)
@@ -1560,18 +1631,18 @@ bool UGripMotionControllerComponent::DropGrip(const FBPActorGripInformation &Gri
 		if (GetNetMode() == ENetMode::NM_Client)
 		{
 			if(!IsTornOff())
-				Server_NotifyLocalGripRemoved(LocallyGrippedObjects[FoundIndex].GripID, OptionalAngularVelocity, OptionalLinearVelocity);
+				Server_NotifyLocalGripRemoved(LocallyGrippedObjects.Grips[FoundIndex].GripID, OptionalAngularVelocity, OptionalLinearVelocity);
 
 			// Have to call this ourselves
-			Drop_Implementation(LocallyGrippedObjects[FoundIndex], bSimulate);
+			Drop_Implementation(LocallyGrippedObjects.Grips[FoundIndex], bSimulate);
 		}
 		else // Server notifyDrop it
 		{
-			NotifyDrop(LocallyGrippedObjects[FoundIndex], bSimulate);
+			NotifyDrop(LocallyGrippedObjects.Grips[FoundIndex], bSimulate);
 		}
 	}
 	else
-		NotifyDrop(GrippedObjects[FoundIndex], bSimulate);
+		NotifyDrop(GrippedObjects.Grips[FoundIndex], bSimulate);
 
 	//GrippedObjects.RemoveAt(FoundIndex);		
 	return true;
@@ -1595,9 +1666,9 @@ bool UGripMotionControllerComponent::DropAndSocketObject(const FTransform_NetQua
 	FBPActorGripInformation * GripInfo = nullptr;
 
 	if (ObjectToDrop)
-		GripInfo = LocallyGrippedObjects.FindByKey(ObjectToDrop);
+		GripInfo = FindLocalGrip(ObjectToDrop);
 	else if (GripIDToDrop != INVALID_VRGRIP_ID)
-		GripInfo = LocallyGrippedObjects.FindByKey(GripIDToDrop);
+		GripInfo = FindLocalGrip(GripIDToDrop);
 
 	if(GripInfo) // This auto checks if Actor and Component are valid in the == operator
 	{
@@ -1612,9 +1683,9 @@ bool UGripMotionControllerComponent::DropAndSocketObject(const FTransform_NetQua
 		}
 
 		if(ObjectToDrop)
-			GripInfo = GrippedObjects.FindByKey(ObjectToDrop);
+			GripInfo = FindReplicatedGrip(ObjectToDrop);
 		else if(GripIDToDrop != INVALID_VRGRIP_ID)
-			GripInfo = GrippedObjects.FindByKey(GripIDToDrop);
+			GripInfo = FindReplicatedGrip(GripIDToDrop);
 
 		if(GripInfo) // This auto checks if Actor and Component are valid in the == operator
 		{
@@ -1644,7 +1715,7 @@ bool UGripMotionControllerComponent::DropAndSocketGrip(const FBPActorGripInforma
 	bool bWasLocalGrip = false;
 	FBPActorGripInformation * GripInfo = nullptr;
 
-	GripInfo = LocallyGrippedObjects.FindByKey(GripToDrop);
+	GripInfo = FindLocalGrip(GripToDrop);
 	if (GripInfo) // This auto checks if Actor and Component are valid in the == operator
 	{
 		bWasLocalGrip = true;
@@ -1657,7 +1728,7 @@ bool UGripMotionControllerComponent::DropAndSocketGrip(const FBPActorGripInforma
 			return false;
 		}
 
-		GripInfo = GrippedObjects.FindByKey(GripToDrop);
+		GripInfo = FindReplicatedGrip(GripToDrop);
 
 		if (GripInfo) // This auto checks if Actor and Component are valid in the == operator
 		{
@@ -1965,27 +2036,27 @@ void UGripMotionControllerComponent::DropAndSocket_Implementation(const FBPActor
 	// Copy over the information instead of working with a reference for the OnDroppedBroadcast
 	FBPActorGripInformation DropBroadcastData = NewDrop;
 
-	int fIndex = 0;
-	if (LocallyGrippedObjects.Find(NewDrop, fIndex))
+	int fIndex = LocallyGrippedObjectsIndex.IndexOf(LocallyGrippedObjects.Grips, NewDrop.GripID);
+	if (fIndex != INDEX_NONE)
 	{
 		if (HasGripAuthority(NewDrop) || GetNetMode() < ENetMode::NM_Client)
 		{
-			LocallyGrippedObjects.RemoveAt(fIndex);
+			RemoveLocalGripAt(fIndex);
 		}
 		else
-			LocallyGrippedObjects[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
+			LocallyGrippedObjects.Grips[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
 	}
 	else
 	{
-		fIndex = 0;
-		if (GrippedObjects.Find(NewDrop, fIndex))
+		fIndex = GrippedObjectsIndex.IndexOf(GrippedObjects.Grips, NewDrop.GripID);
+		if (fIndex != INDEX_NONE)
 		{
 			if (HasGripAuthority(NewDrop) || GetNetMode() < ENetMode::NM_Client)
 			{
-				GrippedObjects.RemoveAt(fIndex);
+				RemoveReplicatedGripAt(fIndex);
 			}
 			else
-				GrippedObjects[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
+				GrippedObjects.Grips[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
 		}
 	}
 
@@ -2259,16 +2330,16 @@ void UGripMotionControllerComponent::Drop_Implementation(const FBPActorGripInfor
 	}	
 	else // Now check for this same hand with duplicate grips on this object
 	{
-		for (int i = 0; i < LocallyGrippedObjects.Num(); ++i)
+		for (int i = 0; i < LocallyGrippedObjects.Grips.Num(); ++i)
 		{
-			if (LocallyGrippedObjects[i].GrippedObject == NewDrop.GrippedObject && LocallyGrippedObjects[i].GripID != NewDrop.GripID)
+			if (LocallyGrippedObjects.Grips[i].GrippedObject == NewDrop.GrippedObject && LocallyGrippedObjects.Grips[i].GripID != NewDrop.GripID)
 			{
 				bSkipFullDrop = true;
 			}
 		}
-		for (int i = 0; i < GrippedObjects.Num(); ++i)
+		for (int i = 0; i < GrippedObjects.Grips.Num(); ++i)
 		{
-			if (GrippedObjects[i].GrippedObject == NewDrop.GrippedObject && GrippedObjects[i].GripID != NewDrop.GripID)
+			if (GrippedObjects.Grips[i].GrippedObject == NewDrop.GrippedObject && GrippedObjects.Grips[i].GripID != NewDrop.GripID)
 			{
 				bSkipFullDrop = true;
 			}
@@ -2503,27 +2574,27 @@ void UGripMotionControllerComponent::Drop_Implementation(const FBPActorGripInfor
 	// Copy over the information instead of working with a reference for the OnDroppedBroadcast
 	FBPActorGripInformation DropBroadcastData = NewDrop;
 
-	int fIndex = 0;
-	if (LocallyGrippedObjects.Find(NewDrop, fIndex))
+	int fIndex = LocallyGrippedObjectsIndex.IndexOf(LocallyGrippedObjects.Grips, NewDrop.GripID);
+	if (fIndex != INDEX_NONE)
 	{
 		if (HasGripAuthority(NewDrop) || GetNetMode() < ENetMode::NM_Client)
 		{
-			LocallyGrippedObjects.RemoveAt(fIndex);
+			RemoveLocalGripAt(fIndex);
 		}
 		else
-			LocallyGrippedObjects[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
+			LocallyGrippedObjects.Grips[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
 	}
 	else
 	{
-		fIndex = 0;
-		if (GrippedObjects.Find(NewDrop, fIndex))
+		fIndex = GrippedObjectsIndex.IndexOf(GrippedObjects.Grips, NewDrop.GripID);
+		if (fIndex != INDEX_NONE)
 		{
 			if (HasGripAuthority(NewDrop) || GetNetMode() < ENetMode::NM_Client)
 			{
-				GrippedObjects.RemoveAt(fIndex);
+				RemoveReplicatedGripAt(fIndex);
 			}
 			else
-				GrippedObjects[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
+				GrippedObjects.Grips[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
 		}
 	}
 
@@ -2543,12 +2614,12 @@ bool UGripMotionControllerComponent::BP_HasGripMovementAuthority(const FBPActorG
 
 bool UGripMotionControllerComponent::AddSecondaryAttachmentPoint(UObject * GrippedObjectToAddAttachment, USceneComponent * SecondaryPointComponent, const FTransform & OriginalTransform, bool bTransformIsAlreadyRelative, float LerpToTime,/* float SecondarySmoothingScaler,*/ bool bIsSlotGrip)
 {
-	if (!GrippedObjectToAddAttachment || !SecondaryPointComponent || (!GrippedObjects.Num() && !LocallyGrippedObjects.Num()))
+	if (!GrippedObjectToAddAttachment || !SecondaryPointComponent || (!GrippedObjects.Grips.Num() && !LocallyGrippedObjects.Grips.Num()))
 		return false;
 
 	FBPActorGripInformation * GripToUse = nullptr;
 
-	GripToUse = LocallyGrippedObjects.FindByKey(GrippedObjectToAddAttachment);
+	GripToUse = FindLocalGrip(GrippedObjectToAddAttachment);
 
 	// Search replicated grips if not found in local
 	if (!GripToUse)
@@ -2560,7 +2631,7 @@ bool UGripMotionControllerComponent::AddSecondaryAttachmentPoint(UObject * Gripp
 			return false;
 		}
 
-		GripToUse = GrippedObjects.FindByKey(GrippedObjectToAddAttachment);
+		GripToUse = FindReplicatedGrip(GrippedObjectToAddAttachment);
 	}
 
 	if (GripToUse)
@@ -2573,12 +2644,12 @@ bool UGripMotionControllerComponent::AddSecondaryAttachmentPoint(UObject * Gripp
 
 bool UGripMotionControllerComponent::AddSecondaryAttachmentToGrip(const FBPActorGripInformation & GripToAddAttachment, USceneComponent * SecondaryPointComponent, const FTransform &OriginalTransform, bool bTransformIsAlreadyRelative, float LerpToTime, bool bIsSlotGrip)
 {
-	if (!GripToAddAttachment.GrippedObject || GripToAddAttachment.GripID == INVALID_VRGRIP_ID || !SecondaryPointComponent || (!GrippedObjects.Num() && !LocallyGrippedObjects.Num()))
+	if (!GripToAddAttachment.GrippedObject || GripToAddAttachment.GripID == INVALID_VRGRIP_ID || !SecondaryPointComponent || (!GrippedObjects.Grips.Num() && !LocallyGrippedObjects.Grips.Num()))
 		return false;
 
 	FBPActorGripInformation * GripToUse = nullptr;
 
-	GripToUse = LocallyGrippedObjects.FindByKey(GripToAddAttachment.GripID);
+	GripToUse = FindLocalGrip(GripToAddAttachment.GripID);
 
 	// Search replicated grips if not found in local
 	if (!GripToUse)
@@ -2590,7 +2661,7 @@ bool UGripMotionControllerComponent::AddSecondaryAttachmentToGrip(const FBPActor
 			return false;
 		}
 
-		GripToUse = GrippedObjects.FindByKey(GripToAddAttachment.GripID);
+		GripToUse = FindReplicatedGrip(GripToAddAttachment.GripID);
 	}
 
 	if (!GripToUse || !GripToUse->GrippedObject)
@@ -2678,6 +2749,8 @@ bool UGripMotionControllerComponent::AddSecondaryAttachmentToGrip(const FBPActor
 		}
 	}
 
+	MarkGripDirty(*GripToUse);
+
 	if (GripToUse->GripMovementReplicationSetting == EGripMovementReplicationSettings::ClientSide_Authoritive && GetNetMode() == ENetMode::NM_Client && !IsTornOff())
 	{
 		Server_NotifySecondaryAttachmentChanged(GripToUse->GripID, GripToUse->SecondaryGripInfo);
@@ -2690,13 +2763,13 @@ bool UGripMotionControllerComponent::AddSecondaryAttachmentToGrip(const FBPActor
 
 bool UGripMotionControllerComponent::RemoveSecondaryAttachmentPoint(UObject * GrippedObjectToRemoveAttachment, float LerpToTime)
 {
-	if (!GrippedObjectToRemoveAttachment || (!GrippedObjects.Num() && !LocallyGrippedObjects.Num()))
+	if (!GrippedObjectToRemoveAttachment || (!GrippedObjects.Grips.Num() && !LocallyGrippedObjects.Grips.Num()))
 		return false;
 
 	FBPActorGripInformation * GripToUse = nullptr;
 
 	// Duplicating the logic for each array for now
-	GripToUse = LocallyGrippedObjects.FindByKey(GrippedObjectToRemoveAttachment);
+	GripToUse = FindLocalGrip(GrippedObjectToRemoveAttachment);
 
 	// Check replicated grips if it wasn't found in local
 	if (!GripToUse)
@@ -2707,7 +2780,7 @@ bool UGripMotionControllerComponent::RemoveSecondaryAttachmentPoint(UObject * Gr
 			return false;
 		}
 
-		GripToUse = GrippedObjects.FindByKey(GrippedObjectToRemoveAttachment);
+		GripToUse = FindReplicatedGrip(GrippedObjectToRemoveAttachment);
 	}
 
 	// Handle the grip if it was found
@@ -2721,13 +2794,13 @@ bool UGripMotionControllerComponent::RemoveSecondaryAttachmentPoint(UObject * Gr
 
 bool UGripMotionControllerComponent::RemoveSecondaryAttachmentFromGrip(const FBPActorGripInformation & GripToRemoveAttachment, float LerpToTime)
 {
-	if (!GripToRemoveAttachment.GrippedObject || GripToRemoveAttachment.GripID == INVALID_VRGRIP_ID || (!GrippedObjects.Num() && !LocallyGrippedObjects.Num()))
+	if (!GripToRemoveAttachment.GrippedObject || GripToRemoveAttachment.GripID == INVALID_VRGRIP_ID || (!GrippedObjects.Grips.Num() && !LocallyGrippedObjects.Grips.Num()))
 		return false;
 
 	FBPActorGripInformation * GripToUse = nullptr;
 
 	// Duplicating the logic for each array for now
-	GripToUse = LocallyGrippedObjects.FindByKey(GripToRemoveAttachment.GripID);
+	GripToUse = FindLocalGrip(GripToRemoveAttachment.GripID);
 
 	// Check replicated grips if it wasn't found in local
 	if (!GripToUse)
@@ -2738,7 +2811,7 @@ bool UGripMotionControllerComponent::RemoveSecondaryAttachmentFromGrip(const FBP
 			return false;
 		}
 
-		GripToUse = GrippedObjects.FindByKey(GripToRemoveAttachment.GripID);
+		GripToUse = FindReplicatedGrip(GripToRemoveAttachment.GripID);
 	}
 
 	// Handle the grip if it was found
@@ -2829,6 +2902,7 @@ bool UGripMotionControllerComponent::RemoveSecondaryAttachmentFromGrip(const FBP
 
 		GripToUse->SecondaryGripInfo.SecondaryAttachment = nullptr;
 		GripToUse->SecondaryGripInfo.bHasSecondaryAttachment = false;
+		MarkGripDirty(*GripToUse);
 
 		if (GripToUse->GripMovementReplicationSetting == EGripMovementReplicationSettings::ClientSide_Authoritive && GetNetMode() == ENetMode::NM_Client)
 		{
@@ -2862,12 +2936,12 @@ bool UGripMotionControllerComponent::RemoveSecondaryAttachmentFromGrip(const FBP
 
 bool UGripMotionControllerComponent::TeleportMoveGrippedActor(AActor * GrippedActorToMove, bool bTeleportPhysicsGrips)
 {
-	if (!GrippedActorToMove || (!GrippedObjects.Num() && !LocallyGrippedObjects.Num()))
+	if (!GrippedActorToMove || (!GrippedObjects.Grips.Num() && !LocallyGrippedObjects.Grips.Num()))
 		return false;
 
-	FBPActorGripInformation * GripInfo = LocallyGrippedObjects.FindByKey(GrippedActorToMove);
+	FBPActorGripInformation * GripInfo = FindLocalGrip(GrippedActorToMove);
 	if (!GripInfo)
-		GrippedObjects.FindByKey(GrippedActorToMove);
+		FindReplicatedGrip(GrippedActorToMove);
 
 	if (GripInfo)
 	{
@@ -2879,12 +2953,12 @@ bool UGripMotionControllerComponent::TeleportMoveGrippedActor(AActor * GrippedAc
 
 bool UGripMotionControllerComponent::TeleportMoveGrippedComponent(UPrimitiveComponent * ComponentToMove, bool bTeleportPhysicsGrips)
 {
-	if (!ComponentToMove || (!GrippedObjects.Num() && !LocallyGrippedObjects.Num()))
+	if (!ComponentToMove || (!GrippedObjects.Grips.Num() && !LocallyGrippedObjects.Grips.Num()))
 		return false;
 
-	FBPActorGripInformation * GripInfo = LocallyGrippedObjects.FindByKey(ComponentToMove);
+	FBPActorGripInformation * GripInfo = FindLocalGrip(ComponentToMove);
 	if (!GripInfo)
-		GrippedObjects.FindByKey(ComponentToMove);
+		FindReplicatedGrip(ComponentToMove);
 
 	if (GripInfo)
 	{
@@ -2900,7 +2974,7 @@ bool UGripMotionControllerComponent::TeleportMoveGrip(FBPActorGripInformation &G
 	return TeleportMoveGrip_Impl(Grip, bTeleportPhysicsGrips, bIsForPostTeleport, EmptyTransform);
 }
 
-bool UGripMotionControllerComponent::TeleportMoveGrip_Impl(FBPActorGripInformation &Grip, bool bTeleportPhysicsGrips, bool bIsForPostTeleport, FTransform & OptionalTransform)
+bool UGripMotionControllerComponent::TeleportMoveGrip_Impl(FBPActorGripInformation &Grip, bool bTeleportPhysicsGrips, bool bIsForPostTeleport, FTransform & OptionalTransform, bool bBatchMove)
 {
 	bool bHasMovementAuthority = HasGripMovementAuthority(Grip);
 
@@ -3043,6 +3117,20 @@ bool UGripMotionControllerComponent::TeleportMoveGrip_Impl(FBPActorGripInformati
 	
 	FBPActorPhysicsHandleInformation * Handle = GetPhysicsGrip(Grip);
 
+	if (bBatchMove && (!Handle || (Handle->KinActorData && bTeleportPhysicsGrips)))
+	{
+		// Don't try to autodrop on next tick, let the physx constraint update its local frame first
+		if (Handle && HasGripAuthority(Grip))
+			Grip.bSkipNextConstraintLengthCheck = true;
+
+		FVRGripTeleportMove & Move = PendingTeleportMoves[PendingTeleportMoves.AddDefaulted()];
+		Move.Component = PrimComp;
+		Move.WorldTransform = WorldTransform;
+		Move.GripID = Grip.GripID;
+		Move.bTeleportPhysicsHandle = Handle != nullptr;
+		return true;
+	}
+
 	if (!Handle)
 	{
 		PrimComp->SetWorldTransform(WorldTransform, false, NULL, ETeleportType::TeleportPhysics);
@@ -3072,20 +3160,85 @@ bool UGripMotionControllerComponent::TeleportMoveGrip_Impl(FBPActorGripInformati
 	return true;
 }
 
+void UGripMotionControllerComponent::FlushTeleportMoves()
+{
+	if (!PendingTeleportMoves.Num())
+		return;
+
+	SCOPE_CYCLE_COUNTER(STAT_TeleportGrips);
+	INC_DWORD_STAT_BY(STAT_TeleportGripsMoved, PendingTeleportMoves.Num());
+
+	// Need to use WITH teleport for this function so that the velocity isn't updated and without sweep so that they don't collide
+	for (const FVRGripTeleportMove & Move : PendingTeleportMoves)
+	{
+		if (UPrimitiveComponent * PrimComp = Move.Component.Get())
+		{
+			PrimComp->SetWorldTransform(Move.WorldTransform, false, NULL, ETeleportType::TeleportPhysics);
+		}
+	}
+
+#if WITH_PHYSX
+	// Kinematic actors of the physics grips are looked up after the moves and grouped by scene so each scene is only locked once
+	TArray<TPair<FBPActorPhysicsHandleInformation*, FTransform>, TInlineAllocator<8>> HandleMoves;
+	for (const FVRGripTeleportMove & Move : PendingTeleportMoves)
+	{
+		if (!Move.bTeleportPhysicsHandle)
+			continue;
+
+		FBPActorPhysicsHandleInformation * Handle = PhysicsGripsIndex.Find(PhysicsGrips, Move.GripID);
+		if (Handle && Handle->KinActorData)
+		{
+			HandleMoves.Emplace(Handle, Move.WorldTransform);
+		}
+	}
+
+	HandleMoves.Sort([](const TPair<FBPActorPhysicsHandleInformation*, FTransform> & A, const TPair<FBPActorPhysicsHandleInformation*, FTransform> & B)
+	{
+		return A.Key->SceneIndex < B.Key->SceneIndex;
+	});
+
+	for (int32 SceneStart = 0; SceneStart < HandleMoves.Num();)
+	{
+		const int32 SceneIndex = HandleMoves[SceneStart].Key->SceneIndex;
+		int32 SceneEnd = SceneStart + 1;
+		while (SceneEnd < HandleMoves.Num() && HandleMoves[SceneEnd].Key->SceneIndex == SceneIndex)
+		{
+			++SceneEnd;
+		}
+
+		if (PxScene* PScene = GetPhysXSceneFromIndex(SceneIndex))
+		{
+			SCOPED_SCENE_WRITE_LOCK(PScene);
+			for (int32 i = SceneStart; i < SceneEnd; ++i)
+			{
+				FBPActorPhysicsHandleInformation * Handle = HandleMoves[i].Key;
+				const PxTransform KinPose = U2PTransform(Handle->RootBoneRotation * HandleMoves[i].Value) * Handle->COMPosition;
+				Handle->KinActorData->setKinematicTarget(KinPose);
+				Handle->KinActorData->setGlobalPose(KinPose);
+			}
+		}
+
+		SceneStart = SceneEnd;
+	}
+#endif
+
+	PendingTeleportMoves.Reset();
+}
+
 void UGripMotionControllerComponent::PostTeleportMoveGrippedObjects()
 {
-	if (!GrippedObjects.Num() && !LocallyGrippedObjects.Num())
+	if (!GrippedObjects.Grips.Num() && !LocallyGrippedObjects.Grips.Num())
 		return;
 
 	this->bIsPostTeleport = true;
-	/*for (int i = 0; i < LocallyGrippedObjects.Num(); i++)
+	/*for (int i = 0; i < LocallyGrippedObjects.Grips.Num(); i++)
 	{
-		TeleportMoveGrip(LocallyGrippedObjects[i], true);
+		TeleportMoveGrip(LocallyGrippedObjects.Grips[i], true);
 	}
 
-	for (int i = 0; i < GrippedObjects.Num(); i++)
+	for (int i = 0; i < GrippedObjects.Grips.Num(); i++)
 	{
-		TeleportMoveGrip(GrippedObjects[i], true);
+		TeleportMoveGrip(GrippedObjects.Grips[i], true);
 	}*/
 }
 
@@ -3138,7 +3291,7 @@ void UGripMotionControllerComponent::TickComponent(float DeltaTime, enum ELevelT
 
 		if (!bUseWithoutTracking)
 		{
-			if (!GripViewExtension.IsValid() && GEngine)
+			if (!GripViewExtension.IsValid() && GEngine && !UVRGlobalSettings::IsServerOptimized())
 			{
 				GripViewExtension = FSceneViewExtensions::NewExtension<FGripViewExtension>(this);
 			}
@@ -3282,7 +3435,7 @@ void UGripMotionControllerComponent::TickGrip(float DeltaTime)
 	SCOPE_CYCLE_COUNTER(STAT_TickGrip);
 
 	// Debug test that we aren't floating physics handles
-	if (PhysicsGrips.Num() > (GrippedObjects.Num() + LocallyGrippedObjects.Num()))
+	if (PhysicsGrips.Num() > (GrippedObjects.Grips.Num() + LocallyGrippedObjects.Grips.Num()))
 	{
 		CleanUpBadPhysicsHandles();
 		UE_LOG(LogVRMotionController, Warning, TEXT("Something went wrong, there were too many physics handles for how many grips exist! Cleaned up bad handles."));
@@ -3292,8 +3445,11 @@ void UGripMotionControllerComponent::TickGrip(float DeltaTime)
 	FTransform ParentTransform = this->GetComponentTransform();
 
 	// Split into separate functions so that I didn't have to combine arrays since I have some removal going on
-	HandleGripArray(GrippedObjects, ParentTransform, DeltaTime, true);
-	HandleGripArray(LocallyGrippedObjects, ParentTransform, DeltaTime);
+	HandleGripArray(GrippedObjects.Grips, ParentTransform, DeltaTime, true);
+	HandleGripArray(LocallyGrippedObjects.Grips, ParentTransform, DeltaTime);
+
+	// Apply the post teleport moves of both arrays together
+	FlushTeleportMoves();
 
 	// Empty out the teleport flag
 	bIsPostTeleport = false;
@@ -3402,7 +3558,7 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 				// If we just teleported, skip this update and just teleport forward
 				if (bIsPostTeleport)
 				{
-					TeleportMoveGrip_Impl(*Grip, true, true, WorldTransform);
+					TeleportMoveGrip_Impl(*Grip, true, true, WorldTransform, GripMotionControllerCvars::bBatchGripTeleports > 0);
 					continue;
 				}
 
@@ -3781,7 +3937,7 @@ void UGripMotionControllerComponent::CleanUpBadGrip(TArray<FBPActorGripInformati
 			{
 				// Need to delete it from the physics thread
 				DestroyPhysicsHandle(PhysicsGrips[g].SceneIndex, &PhysicsGrips[g].HandleData, &PhysicsGrips[g].KinActorData);
-				PhysicsGrips.RemoveAt(g);
+				RemovePhysicsGripAt(g);
 			}
 		}
 	}
@@ -3802,15 +3958,15 @@ void UGripMotionControllerComponent::CleanUpBadPhysicsHandles()
 	// Clean up tailing physics handles with null objects
 	for (int g = PhysicsGrips.Num() - 1; g >= 0; --g)
 	{
-		FBPActorGripInformation * GripInfo = LocallyGrippedObjects.FindByKey(PhysicsGrips[g].GripID);
+		FBPActorGripInformation * GripInfo = FindLocalGrip(PhysicsGrips[g].GripID);
 		if(!GripInfo)
-			GrippedObjects.FindByKey(PhysicsGrips[g].GripID);
+			GripInfo = FindReplicatedGrip(PhysicsGrips[g].GripID);
 
 		if (!GripInfo)
 		{
 			// Need to delete it from the physics thread
 			DestroyPhysicsHandle(PhysicsGrips[g].SceneIndex, &PhysicsGrips[g].HandleData, &PhysicsGrips[g].KinActorData);
-			PhysicsGrips.RemoveAt(g);
+			RemovePhysicsGripAt(g);
 		}
 	}
 }
@@ -3875,7 +4031,9 @@ bool UGripMotionControllerComponent::DestroyPhysicsHandle(const FBPActorGripInfo
 
 	int index;
 	if (GetPhysicsGripIndex(Grip, index))
-		PhysicsGrips.RemoveAt(index);
+	{
+		RemovePhysicsGripAt(index);
+	}
 
 	return true;
 }
@@ -4296,7 +4454,7 @@ void UGripMotionControllerComponent::UpdatePhysicsHandleTransform(const FBPActor
 
 		// Debug draw for COM movement with physics grips
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-		if (GripMotionControllerCvars::DrawDebugGripCOM)
+		if (GripMotionControllerCvars::DrawDebugGripCOM && !UVRGlobalSettings::IsServerOptimized())
 		{
 			UPrimitiveComponent * me = Cast<UPrimitiveComponent>(GrippedActor.GripTargetType == EGripTargetType::ActorGrip ? GrippedActor.GetGrippedActor()->GetRootComponent() : GrippedActor.GetGrippedComponent());
 			FVector curCOMPosition = me->GetBodyInstance(GrippedActor.GrippedBoneName)->GetCOMPosition();//rBodyInstance->GetUnrealWorldTransform().InverseTransformPosition(rBodyInstance->GetCOMPosition());
@@ -4604,54 +4762,64 @@ bool UGripMotionControllerComponent::FGripViewExtension::IsActiveThisFrame(class
 
 void UGripMotionControllerComponent::GetAllGrips(TArray<FBPActorGripInformation> &GripArray)
 {
-	GripArray.Append(GrippedObjects);
-	GripArray.Append(LocallyGrippedObjects);
+	GripArray.Append(GrippedObjects.Grips);
+	GripArray.Append(LocallyGrippedObjects.Grips);
+}
+
+void UGripMotionControllerComponent::GetReplicatedGrips(TArray<FBPActorGripInformation> &GripArray)
+{
+	GripArray = GrippedObjects.Grips;
+}
+
+void UGripMotionControllerComponent::GetLocalGrips(TArray<FBPActorGripInformation> &GripArray)
+{
+	GripArray = LocallyGrippedObjects.Grips;
 }
 
 void UGripMotionControllerComponent::GetGrippedObjects(TArray<UObject*> &GrippedObjectsArray)
 {
-	for (int i = 0; i < GrippedObjects.Num(); ++i)
+	for (int i = 0; i < GrippedObjects.Grips.Num(); ++i)
 	{
-		if (GrippedObjects[i].GrippedObject)
-			GrippedObjectsArray.Add(GrippedObjects[i].GrippedObject);
+		if (GrippedObjects.Grips[i].GrippedObject)
+			GrippedObjectsArray.Add(GrippedObjects.Grips[i].GrippedObject);
 	}
 
-	for (int i = 0; i < LocallyGrippedObjects.Num(); ++i)
+	for (int i = 0; i < LocallyGrippedObjects.Grips.Num(); ++i)
 	{
-		if (LocallyGrippedObjects[i].GrippedObject)
-			GrippedObjectsArray.Add(LocallyGrippedObjects[i].GrippedObject);
+		if (LocallyGrippedObjects.Grips[i].GrippedObject)
+			GrippedObjectsArray.Add(LocallyGrippedObjects.Grips[i].GrippedObject);
 	}
 
 }
 
 void UGripMotionControllerComponent::GetGrippedActors(TArray<AActor*> &GrippedObjectsArray)
 {
-	for (int i = 0; i < GrippedObjects.Num(); ++i)
+	for (int i = 0; i < GrippedObjects.Grips.Num(); ++i)
 	{
-		if(GrippedObjects[i].GetGrippedActor())
-			GrippedObjectsArray.Add(GrippedObjects[i].GetGrippedActor());
+		if(GrippedObjects.Grips[i].GetGrippedActor())
+			GrippedObjectsArray.Add(GrippedObjects.Grips[i].GetGrippedActor());
 	}
 
-	for (int i = 0; i < LocallyGrippedObjects.Num(); ++i)
+	for (int i = 0; i < LocallyGrippedObjects.Grips.Num(); ++i)
 	{
-		if (LocallyGrippedObjects[i].GetGrippedActor())
-			GrippedObjectsArray.Add(LocallyGrippedObjects[i].GetGrippedActor());
+		if (LocallyGrippedObjects.Grips[i].GetGrippedActor())
+			GrippedObjectsArray.Add(LocallyGrippedObjects.Grips[i].GetGrippedActor());
 	}
 
 }
 
 void UGripMotionControllerComponent::GetGrippedComponents(TArray<UPrimitiveComponent*> &GrippedComponentsArray)
 {
-	for (int i = 0; i < GrippedObjects.Num(); ++i)
+	for (int i = 0; i < GrippedObjects.Grips.Num(); ++i)
 	{
-		if (GrippedObjects[i].GetGrippedComponent())
-			GrippedComponentsArray.Add(GrippedObjects[i].GetGrippedComponent());
+		if (GrippedObjects.Grips[i].GetGrippedComponent())
+			GrippedComponentsArray.Add(GrippedObjects.Grips[i].GetGrippedComponent());
 	}
 
-	for (int i = 0; i < LocallyGrippedObjects.Num(); ++i)
+	for (int i = 0; i < LocallyGrippedObjects.Grips.Num(); ++i)
 	{
-		if (LocallyGrippedObjects[i].GetGrippedComponent())
-			GrippedComponentsArray.Add(LocallyGrippedObjects[i].GetGrippedComponent());
+		if (LocallyGrippedObjects.Grips[i].GetGrippedComponent())
+			GrippedComponentsArray.Add(LocallyGrippedObjects.Grips[i].GetGrippedComponent());
 	}
 }
 
@@ -4688,22 +4856,20 @@ void UGripMotionControllerComponent::Server_NotifyLocalGripAddedOrChanged_Implem
 		return;
 	}
 
-	if (!LocallyGrippedObjects.Contains(newGrip))
+	FBPActorGripInformation * FoundGrip = FindLocalGrip(newGrip);
+	if (!FoundGrip)
 	{
-		int32 NewIndex = LocallyGrippedObjects.Add(newGrip);
+		int32 NewIndex = AddLocalGrip(newGrip);
 
-		HandleGripReplication(LocallyGrippedObjects[NewIndex]);
+		HandleGripReplication(LocallyGrippedObjects.Grips[NewIndex]);
 		// Initialize the differences, clients will do this themselves on the rep back, this sets up the cache
 		//HandleGripReplication(LocallyGrippedObjects[LocallyGrippedObjects.Num() - 1]);
 	}
 	else
 	{
-		int32 IndexFound;
-		if (LocallyGrippedObjects.Find(newGrip, IndexFound))
-		{
-			LocallyGrippedObjects[IndexFound].RepCopy(newGrip);
-			HandleGripReplication(LocallyGrippedObjects[IndexFound]);
-		}
+		FoundGrip->RepCopy(newGrip);
+		LocallyGrippedObjects.MarkItemDirty(*FoundGrip);
+		HandleGripReplication(*FoundGrip);
 	}
 
 	// Server has to call this themselves
@@ -4744,11 +4910,12 @@ void UGripMotionControllerComponent::Server_NotifySecondaryAttachmentChanged_Imp
 	const FBPSecondaryGripInfo& SecondaryGripInfo)
 {
 
-	FBPActorGripInformation * GripInfo = LocallyGrippedObjects.FindByKey(GripID);
+	FBPActorGripInformation * GripInfo = FindLocalGrip(GripID);
 	if (GripInfo != nullptr)
 	{
 		// I override the = operator now so that it won't set the lerp components
 		GripInfo->SecondaryGripInfo.RepCopy(SecondaryGripInfo);
+		LocallyGrippedObjects.MarkItemDirty(*GripInfo);
 
 		// Initialize the differences, clients will do this themselves on the rep back
 		HandleGripReplication(*GripInfo);
@@ -4768,12 +4935,13 @@ void UGripMotionControllerComponent::Server_NotifySecondaryAttachmentChanged_Ret
 	const FBPSecondaryGripInfo& SecondaryGripInfo, const FTransform_NetQuantize & NewRelativeTransform)
 {
 
-	FBPActorGripInformation * GripInfo = LocallyGrippedObjects.FindByKey(GripID);
+	FBPActorGripInformation * GripInfo = FindLocalGrip(GripID);
 	if (GripInfo != nullptr)
 	{
 		// I override the = operator now so that it won't set the lerp components
 		GripInfo->SecondaryGripInfo.RepCopy(SecondaryGripInfo);
 		GripInfo->RelativeTransform = NewRelativeTransform;
+		LocallyGrippedObjects.MarkItemDirty(*GripInfo);
 
 		// Initialize the differences, clients will do this themselves on the rep back
 		HandleGripReplication(*GripInfo);
@@ -4847,8 +5015,8 @@ void FExpandedLateUpdateManager::Setup(const FTransform& ParentToWorld, UGripMot
 	}
 
 
-	ProcessGripArrayLateUpdatePrimitives(Component, Component->LocallyGrippedObjects);
-	ProcessGripArrayLateUpdatePrimitives(Component, Component->GrippedObjects);
+	ProcessGripArrayLateUpdatePrimitives(Component, Component->LocallyGrippedObjects.Grips);
+	ProcessGripArrayLateUpdatePrimitives(Component, Component->GrippedObjects.Grips);
 
 	LateUpdateGameWriteIndex = (LateUpdateGameWriteIndex + 1) % 2;
 }
@@ -4,6 +4,22 @@
 #include "GripMotionControllerComponent.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/NetDriver.h"
+#include "Engine/ActorChannel.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("GripScripts Replicated"), STAT_GripScriptsReplicated, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GripScripts Replication Skipped"), STAT_GripScriptsReplicationSkipped, STATGROUP_Game);
+
+namespace VRGripScriptCVars
+{
+	static int32 bConditionalGripScriptReplication = 1;
+	FAutoConsoleVariableRef CVarConditionalGripScriptReplication(
+		TEXT("vre.ConditionalGripScriptReplication"),
+		bConditionalGripScriptReplication,
+		TEXT("When on, grippables only replicate their grip scripts initially and after the scripts are marked dirty.\n")
+		TEXT("0: Replicate every grip script on every net update"),
+		ECVF_Default);
+}
  
 UVRGripScriptBase::UVRGripScriptBase(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -12,6 +28,7 @@ UVRGripScriptBase::UVRGripScriptBase(const FObjectInitializer& ObjectInitializer
 //	PrimaryComponentTick.bStartWithTickEnabled = false;
 //	PrimaryComponentTick.TickGroup = ETickingGroup::TG_PrePhysics;
 	WorldTransformOverrideType = EGSTransformOverrideType::None;
+	bReplicateOnlyWhenDirty = false;
 }
 
 
@@ -43,6 +60,49 @@ void UVRGripScriptBase::GetLifetimeReplicatedProps(TArray< class FLifetimeProper
 	}
 }
 
+void UVRGripScriptBase::MarkReplicatedStateDirty()
+{
+	ReplicatedChannels.Reset();
+}
+
+bool UVRGripScriptBase::ShouldReplicateToChannel(UActorChannel * Channel, const FReplicationFlags & RepFlags)
+{
+	bool bReplicate = !VRGripScriptCVars::bConditionalGripScriptReplication;
+
+	if (!bReplicate)
+	{
+		// The first replication on a channel sets the script up on it, after that only replicated properties need sending
+		if (RepFlags.bNetInitial || !Channel->ReplicationMap.Contains(this))
+			bReplicate = true;
+		else if (GetClass()->ClassReps.Num())
+			bReplicate = !bReplicateOnlyWhenDirty || !ReplicatedChannels.Contains(Channel);
+	}
+
+	if (!bReplicate)
+	{
+		INC_DWORD_STAT(STAT_GripScriptsReplicationSkipped);
+		return false;
+	}
+
+	if (bReplicateOnlyWhenDirty)
+	{
+		// Drop channels that have closed before the set grows
+		if (ReplicatedChannels.Num() >= 16)
+		{
+			for (auto It = ReplicatedChannels.CreateIterator(); It; ++It)
+			{
+				if (!It->IsValid())
+					It.RemoveCurrent();
+			}
+		}
+
+		ReplicatedChannels.Add(Channel);
+	}
+
+	INC_DWORD_STAT(STAT_GripScriptsReplicated);
+	return true;
+}
+
 bool UVRGripScriptBase::CallRemoteFunction(UFunction * Function, void * Parms, FOutParmRec * OutParms, FFrame * Stack)
 {
 	AActor* Owner = GetOwner();//Cast<AActor>(GetOuter());
@@ -2,6 +2,7 @@
 
 #include "Grippables/GrippableActor.h"
 #include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
 
 
   //=============================================================================
@@ -33,6 +34,7 @@ AGrippableActor::AGrippableActor(const FObjectInitializer& ObjectInitializer)
 	
 	bRepGripSettingsAndGameplayTags = true;
 	bAllowIgnoringAttachOnOwner = true;
+	bAutoNetDormancy = false;
 
 	// Setting a minimum of every 3rd frame (VR 90fps) for replication consideration
 	// Otherwise we will get some massive slow downs if the replication is allowed to hit the 2 per second minimum default
@@ -65,7 +67,7 @@ bool AGrippableActor::ReplicateSubobjects(UActorChannel* Channel, class FOutBunc
 
 	for (UVRGripScriptBase* Script : GripLogicScripts)
 	{
-		if (Script && !Script->IsPendingKill())
+		if (Script && !Script->IsPendingKill() && Script->ShouldReplicateToChannel(Channel, *RepFlags))
 		{
 			WroteSomething |= Channel->ReplicateSubobject(Script, *Bunch, *RepFlags);
 		}
@@ -92,6 +94,56 @@ void AGrippableActor::BeginPlay()
 			Script->OnBeginPlay(this);
 		}
 	}
+
+	if (bAutoNetDormancy && Role == ROLE_Authority)
+	{
+		if (UPrimitiveComponent * RootPrim = Cast<UPrimitiveComponent>(GetRootComponent()))
+		{
+			RootPrim->OnComponentWake.AddUniqueDynamic(this, &AGrippableActor::OnRootPhysicsWakeOrSleep);
+			RootPrim->OnComponentSleep.AddUniqueDynamic(this, &AGrippableActor::OnRootPhysicsWakeOrSleep);
+		}
+
+		UpdateAutoNetDormancy();
+	}
+}
+
+void AGrippableActor::PreRegisterAllComponents()
+{
+	Super::PreRegisterAllComponents();
+
+	// Sleep notifies are set up when the body is created, so this can't wait for begin play
+	if (bAutoNetDormancy)
+	{
+		if (UPrimitiveComponent * RootPrim = Cast<UPrimitiveComponent>(GetRootComponent()))
+		{
+			RootPrim->BodyInstance.bGenerateWakeEvents = true;
+		}
+	}
+}
+
+void AGrippableActor::UpdateAutoNetDormancy()
+{
+	if (!bAutoNetDormancy || Role != ROLE_Authority || GetNetMode() == NM_Standalone || NetDormancy == DORM_Never || IsPendingKillPending())
+		return;
+
+	UPrimitiveComponent * RootPrim = Cast<UPrimitiveComponent>(GetRootComponent());
+	const bool bAtRest = !RootPrim || !RootPrim->IsSimulatingPhysics() || !RootPrim->RigidBodyIsAwake();
+
+	if (VRGripInterfaceSettings.bIsHeld || !bAtRest)
+	{
+		if (NetDormancy > DORM_Awake)
+			SetNetDormancy(DORM_Awake);
+	}
+	else if (NetDormancy != DORM_DormantAll)
+	{
+		// The channel still sends any pending changes before it goes dormant
+		SetNetDormancy(DORM_DormantAll);
+	}
+}
+
+void AGrippableActor::OnRootPhysicsWakeOrSleep(UPrimitiveComponent * PhysicsComponent, FName BoneName)
+{
+	UpdateAutoNetDormancy();
 }
 
 
@@ -193,6 +245,16 @@ void AGrippableActor::SetHeld_Implementation(UGripMotionControllerComponent * Ho
 		VRGripInterfaceSettings.HoldingController = nullptr;
 
 	VRGripInterfaceSettings.bIsHeld = bIsHeld;
+
+	if (bAutoNetDormancy && Role == ROLE_Authority)
+	{
+		// Grip and drop state goes out with this update, a released actor is checked for rest once the drop has set up its physics
+		if (NetDormancy > DORM_Awake)
+			SetNetDormancy(DORM_Awake);
+
+		if (!bIsHeld)
+			GetWorldTimerManager().SetTimerForNextTick(this, &AGrippableActor::UpdateAutoNetDormancy);
+	}
 }
 
 bool AGrippableActor::GetGripScripts_Implementation(TArray<UVRGripScriptBase*> & ArrayReference)
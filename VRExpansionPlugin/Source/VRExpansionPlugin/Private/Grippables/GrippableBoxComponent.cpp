@@ -67,7 +67,7 @@ bool UGrippableBoxComponent::ReplicateSubobjects(UActorChannel* Channel, class F
 
 	for (UVRGripScriptBase* Script : GripLogicScripts)
 	{
-		if (Script && !Script->IsPendingKill())
+		if (Script && !Script->IsPendingKill() && Script->ShouldReplicateToChannel(Channel, *RepFlags))
 		{
 			WroteSomething |= Channel->ReplicateSubobject(Script, *Bunch, *RepFlags);
 		}
@@ -2,6 +2,7 @@
 
 #include "Grippables/GrippableSkeletalMeshActor.h"
 #include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
 
 UOptionalRepSkeletalMeshComponent::UOptionalRepSkeletalMeshComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -57,6 +58,7 @@ AGrippableSkeletalMeshActor::AGrippableSkeletalMeshActor(const FObjectInitialize
 
 	bRepGripSettingsAndGameplayTags = true;
 	bAllowIgnoringAttachOnOwner = true;
+	bAutoNetDormancy = false;
 
 	// Setting a minimum of every 3rd frame (VR 90fps) for replication consideration
 	// Otherwise we will get some massive slow downs if the replication is allowed to hit the 2 per second minimum default
@@ -89,7 +91,7 @@ bool AGrippableSkeletalMeshActor::ReplicateSubobjects(UActorChannel* Channel, cl
 
 	for (UVRGripScriptBase* Script : GripLogicScripts)
 	{
-		if (Script && !Script->IsPendingKill())
+		if (Script && !Script->IsPendingKill() && Script->ShouldReplicateToChannel(Channel, *RepFlags))
 		{
 			WroteSomething |= Channel->ReplicateSubobject(Script, *Bunch, *RepFlags);
 		}
@@ -121,6 +123,56 @@ void AGrippableSkeletalMeshActor::BeginPlay()
 			Script->OnBeginPlay(this);
 		}
 	}
+
+	if (bAutoNetDormancy && Role == ROLE_Authority)
+	{
+		if (UPrimitiveComponent * RootPrim = Cast<UPrimitiveComponent>(GetRootComponent()))
+		{
+			RootPrim->OnComponentWake.AddUniqueDynamic(this, &AGrippableSkeletalMeshActor::OnRootPhysicsWakeOrSleep);
+			RootPrim->OnComponentSleep.AddUniqueDynamic(this, &AGrippableSkeletalMeshActor::OnRootPhysicsWakeOrSleep);
+		}
+
+		UpdateAutoNetDormancy();
+	}
+}
+
+void AGrippableSkeletalMeshActor::PreRegisterAllComponents()
+{
+	Super::PreRegisterAllComponents();
+
+	// Sleep notifies are set up when the body is created, so this can't wait for begin play
+	if (bAutoNetDormancy)
+	{
+		if (UPrimitiveComponent * RootPrim = Cast<UPrimitiveComponent>(GetRootComponent()))
+		{
+			RootPrim->BodyInstance.bGenerateWakeEvents = true;
+		}
+	}
+}
+
+void AGrippableSkeletalMeshActor::UpdateAutoNetDormancy()
+{
+	if (!bAutoNetDormancy || Role != ROLE_Authority || GetNetMode() == NM_Standalone || NetDormancy == DORM_Never || IsPendingKillPending())
+		return;
+
+	UPrimitiveComponent * RootPrim = Cast<UPrimitiveComponent>(GetRootComponent());
+	const bool bAtRest = !RootPrim || !RootPrim->IsSimulatingPhysics() || !RootPrim->RigidBodyIsAwake();
+
+	if (VRGripInterfaceSettings.bIsHeld || !bAtRest)
+	{
+		if (NetDormancy > DORM_Awake)
+			SetNetDormancy(DORM_Awake);
+	}
+	else if (NetDormancy != DORM_DormantAll)
+	{
+		// The channel still sends any pending changes before it goes dormant
+		SetNetDormancy(DORM_DormantAll);
+	}
+}
+
+void AGrippableSkeletalMeshActor::OnRootPhysicsWakeOrSleep(UPrimitiveComponent * PhysicsComponent, FName BoneName)
+{
+	UpdateAutoNetDormancy();
 }
 
 void AGrippableSkeletalMeshActor::SetDenyGripping(bool bDenyGripping)
@@ -221,6 +273,16 @@ void AGrippableSkeletalMeshActor::SetHeld_Implementation(UGripMotionControllerCo
 		VRGripInterfaceSettings.HoldingController = nullptr;
 
 	VRGripInterfaceSettings.bIsHeld = bIsHeld;
+
+	if (bAutoNetDormancy && Role == ROLE_Authority)
+	{
+		// Grip and drop state goes out with this update, a released actor is checked for rest once the drop has set up its physics
+		if (NetDormancy > DORM_Awake)
+			SetNetDormancy(DORM_Awake);
+
+		if (!bIsHeld)
+			GetWorldTimerManager().SetTimerForNextTick(this, &AGrippableSkeletalMeshActor::UpdateAutoNetDormancy);
+	}
 }
 
 /*FBPInteractionSettings AGrippableSkeletalMeshActor::GetInteractionSettings_Implementation()
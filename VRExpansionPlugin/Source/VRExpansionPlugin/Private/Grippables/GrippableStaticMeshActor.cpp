@@ -2,6 +2,7 @@
 
 #include "Grippables/GrippableStaticMeshActor.h"
 #include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
 
 // #TODO: Pull request this? This macro could be very useful
 /*#define DOREPLIFETIME_CHANGE_NOTIFY(c,v,rncond) \
@@ -80,6 +81,7 @@ AGrippableStaticMeshActor::AGrippableStaticMeshActor(const FObjectInitializer& O
 	
 	bRepGripSettingsAndGameplayTags = true;
 	bAllowIgnoringAttachOnOwner = true;
+	bAutoNetDormancy = false;
 
 	// Setting a minimum of every 3rd frame (VR 90fps) for replication consideration
 	// Otherwise we will get some massive slow downs if the replication is allowed to hit the 2 per second minimum default
@@ -111,7 +113,7 @@ bool AGrippableStaticMeshActor::ReplicateSubobjects(UActorChannel* Channel, clas
 
 	for (UVRGripScriptBase* Script : GripLogicScripts)
 	{
-		if (Script && !Script->IsPendingKill())
+		if (Script && !Script->IsPendingKill() && Script->ShouldReplicateToChannel(Channel, *RepFlags))
 		{
 			WroteSomething |= Channel->ReplicateSubobject(Script, *Bunch, *RepFlags);
 		}
@@ -138,6 +140,56 @@ void AGrippableStaticMeshActor::BeginPlay()
 			Script->OnBeginPlay(this);
 		}
 	}
+
+	if (bAutoNetDormancy && Role == ROLE_Authority)
+	{
+		if (UPrimitiveComponent * RootPrim = Cast<UPrimitiveComponent>(GetRootComponent()))
+		{
+			RootPrim->OnComponentWake.AddUniqueDynamic(this, &AGrippableStaticMeshActor::OnRootPhysicsWakeOrSleep);
+			RootPrim->OnComponentSleep.AddUniqueDynamic(this, &AGrippableStaticMeshActor::OnRootPhysicsWakeOrSleep);
+		}
+
+		UpdateAutoNetDormancy();
+	}
+}
+
+void AGrippableStaticMeshActor::PreRegisterAllComponents()
+{
+	Super::PreRegisterAllComponents();
+
+	// Sleep notifies are set up when the body is created, so this can't wait for begin play
+	if (bAutoNetDormancy)
+	{
+		if (UPrimitiveComponent * RootPrim = Cast<UPrimitiveComponent>(GetRootComponent()))
+		{
+			RootPrim->BodyInstance.bGenerateWakeEvents = true;
+		}
+	}
+}
+
+void AGrippableStaticMeshActor::UpdateAutoNetDormancy()
+{
+	if (!bAutoNetDormancy || Role != ROLE_Authority || GetNetMode() == NM_Standalone || NetDormancy == DORM_Never || IsPendingKillPending())
+		return;
+
+	UPrimitiveComponent * RootPrim = Cast<UPrimitiveComponent>(GetRootComponent());
+	const bool bAtRest = !RootPrim || !RootPrim->IsSimulatingPhysics() || !RootPrim->RigidBodyIsAwake();
+
+	if (VRGripInterfaceSettings.bIsHeld || !bAtRest)
+	{
+		if (NetDormancy > DORM_Awake)
+			SetNetDormancy(DORM_Awake);
+	}
+	else if (NetDormancy != DORM_DormantAll)
+	{
+		// The channel still sends any pending changes before it goes dormant
+		SetNetDormancy(DORM_DormantAll);
+	}
+}
+
+void AGrippableStaticMeshActor::OnRootPhysicsWakeOrSleep(UPrimitiveComponent * PhysicsComponent, FName BoneName)
+{
+	UpdateAutoNetDormancy();
 }
 
 void AGrippableStaticMeshActor::SetDenyGripping(bool bDenyGripping)
@@ -238,6 +290,16 @@ void AGrippableStaticMeshActor::SetHeld_Implementation(UGripMotionControllerComp
 		VRGripInterfaceSettings.HoldingController = nullptr;
 
 	VRGripInterfaceSettings.bIsHeld = bIsHeld;
+
+	if (bAutoNetDormancy && Role == ROLE_Authority)
+	{
+		// Grip and drop state goes out with this update, a released actor is checked for rest once the drop has set up its physics
+		if (NetDormancy > DORM_Awake)
+			SetNetDormancy(DORM_Awake);
+
+		if (!bIsHeld)
+			GetWorldTimerManager().SetTimerForNextTick(this, &AGrippableStaticMeshActor::UpdateAutoNetDormancy);
+	}
 }
 
 /*FBPInteractionSettings AGrippableStaticMeshActor::GetInteractionSettings_Implementation()
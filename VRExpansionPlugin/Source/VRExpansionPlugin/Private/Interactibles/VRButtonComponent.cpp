@@ -1,6 +1,7 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "Interactibles/VRButtonComponent.h"
+#include "Interactibles/VRInteractibleSimulation.h"
 #include "Gameframework/Character.h"
 
   //=============================================================================
@@ -44,6 +45,12 @@ void UVRButtonComponent::BeginPlay()
 	SetButtonToRestingPosition();
 }
 
+void UVRButtonComponent::OnUnregister()
+{
+	FVRInteractibleSimulation::Get().Sleep(this);
+	Super::OnUnregister();
+}
+
 void UVRButtonComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	// Call supers tick (though I don't think any of the base classes to this actually implement it)
@@ -95,7 +102,7 @@ void UVRButtonComponent::TickComponent(float DeltaTime, enum ELevelTick TickType
 		// Std precision tolerance should be fine
 		if (this->RelativeLocation.Equals(GetTargetRelativeLocation()))
 		{
-			this->SetComponentTickEnabled(false);
+			FVRInteractibleSimulation::Get().Sleep(this);
 			InteractingComponent.Reset(); // Just reset it here so it only does it once
 		}
 		else
@@ -173,7 +180,7 @@ void UVRButtonComponent::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AAc
 		InitialComponentLoc = OriginalBaseTransform.InverseTransformPosition(this->GetComponentLocation());
 		bToggledThisTouch = false;
 
-		this->SetComponentTickEnabled(true);
+		FVRInteractibleSimulation::Get().Wake(this);
 	}
 }
 
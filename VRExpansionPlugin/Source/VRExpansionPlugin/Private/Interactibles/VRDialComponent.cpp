@@ -1,6 +1,7 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "Interactibles/VRDialComponent.h"
+#include "Interactibles/VRInteractibleSimulation.h"
 #include "Net/UnrealNetwork.h"
 
   //=============================================================================
@@ -73,6 +74,12 @@ void UVRDialComponent::BeginPlay()
 	ResetInitialDialLocation();
 }
 
+void UVRDialComponent::OnUnregister()
+{
+	FVRInteractibleSimulation::Get().Sleep(this);
+	Super::OnUnregister();
+}
+
 void UVRDialComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	if (bIsLerping)
@@ -85,7 +92,7 @@ void UVRDialComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 
 		if (CurRotBackEnd == 0.f)
 		{
-			this->SetComponentTickEnabled(false);
+			FVRInteractibleSimulation::Get().Sleep(this);
 			bIsLerping = false;
 			OnDialFinishedLerping.Broadcast();
 			ReceiveDialFinishedLerping();
@@ -93,7 +100,7 @@ void UVRDialComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 	}
 	else
 	{
-		this->SetComponentTickEnabled(false);
+		FVRInteractibleSimulation::Get().Sleep(this);
 	}
 }
 
@@ -151,10 +158,10 @@ void UVRDialComponent::OnGripRelease_Implementation(UGripMotionControllerCompone
 	if (bLerpBackOnRelease)
 	{
 		bIsLerping = true;
-		this->SetComponentTickEnabled(true);
+		FVRInteractibleSimulation::Get().Wake(this);
 	}
 	else
-		this->SetComponentTickEnabled(false);
+		FVRInteractibleSimulation::Get().Sleep(this);
 }
 
 void UVRDialComponent::OnChildGrip_Implementation(UGripMotionControllerComponent * GrippingController, const FBPActorGripInformation & GripInformation) {}
@@ -0,0 +1,211 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interactibles/VRInteractibleSimulation.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Interactible Simulation"), STAT_InteractibleSimulation, STATGROUP_Game);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Interactibles Awake"), STAT_InteractiblesAwake, STATGROUP_Game);
+
+namespace VRInteractibleSimulationCVars
+{
+	static int32 bBatchInteractibleTicks = 1;
+	FAutoConsoleVariableRef CVarBatchInteractibleTicks(
+		TEXT("vre.BatchInteractibleTicks"),
+		bBatchInteractibleTicks,
+		TEXT("When on, moving levers, sliders, dials and buttons are stepped by one tick per world instead of their own tick functions.\n")
+		TEXT("0: Each interactible enables its own tick while it moves"),
+		ECVF_Default);
+}
+
+void FVRInteractibleTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Simulation)
+	{
+		Simulation->Tick(DeltaTime, TickType);
+	}
+}
+
+FString FVRInteractibleTickFunction::DiagnosticMessage()
+{
+	return TEXT("FVRInteractibleTickFunction");
+}
+
+FVRInteractibleWorldSimulation::FVRInteractibleWorldSimulation(UWorld * InWorld) :
+	World(InWorld),
+	bTicking(false)
+{
+	TickFunction.Simulation = this;
+	TickFunction.TickGroup = TG_DuringPhysics;
+	TickFunction.bCanEverTick = true;
+	TickFunction.bStartWithTickEnabled = false;
+	TickFunction.RegisterTickFunction(World->PersistentLevel);
+}
+
+FVRInteractibleWorldSimulation::~FVRInteractibleWorldSimulation()
+{
+	TickFunction.UnRegisterTickFunction();
+}
+
+void FVRInteractibleWorldSimulation::Add(UActorComponent * Component)
+{
+	if (ComponentIndices.Contains(Component))
+		return;
+
+	ComponentIndices.Add(Component, Components.Add(Component));
+	SleptDuringTick.RemoveSingleSwap(Component, false);
+
+	if (Components.Num() == 1)
+	{
+		TickFunction.SetTickFunctionEnable(true);
+	}
+}
+
+void FVRInteractibleWorldSimulation::Remove(UActorComponent * Component)
+{
+	int32 Index = INDEX_NONE;
+	if (!ComponentIndices.RemoveAndCopyValue(Component, Index))
+		return;
+
+	Components.RemoveAtSwap(Index, 1, false);
+	if (Components.IsValidIndex(Index))
+	{
+		ComponentIndices[Components[Index]] = Index;
+	}
+
+	if (bTicking)
+	{
+		SleptDuringTick.Add(Component);
+	}
+
+	if (!Components.Num())
+	{
+		TickFunction.SetTickFunctionEnable(false);
+	}
+}
+
+void FVRInteractibleWorldSimulation::Tick(float DeltaTime, ELevelTick TickType)
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractibleSimulation);
+	SET_DWORD_STAT(STAT_InteractiblesAwake, Components.Num());
+
+	TickingComponents = Components;
+	SleptDuringTick.Reset();
+	bTicking = true;
+
+	for (UActorComponent * Component : TickingComponents)
+	{
+		// Put to sleep by an earlier component this frame
+		if (SleptDuringTick.Num() && SleptDuringTick.Contains(Component))
+			continue;
+
+		// Same checks as the components own tick function would do
+		if (!Component->IsRegistered() || Component->IsPendingKill())
+			continue;
+
+		if (TickType == LEVELTICK_ViewportsOnly && !Component->bTickInEditor)
+			continue;
+
+		AActor * Owner = Component->GetOwner();
+		const float DilatedTime = Owner ? DeltaTime * Owner->CustomTimeDilation : DeltaTime;
+
+		Component->TickComponent(DilatedTime, TickType, &Component->PrimaryComponentTick);
+	}
+
+	bTicking = false;
+	TickingComponents.Reset();
+	SleptDuringTick.Reset();
+}
+
+FVRInteractibleSimulation & FVRInteractibleSimulation::Get()
+{
+	check(IsInGameThread());
+	static FVRInteractibleSimulation InteractibleSimulation;
+	return InteractibleSimulation;
+}
+
+FVRInteractibleSimulation::FVRInteractibleSimulation()
+{
+	FWorldDelegates::OnWorldCleanup.AddRaw(this, &FVRInteractibleSimulation::OnWorldCleanup);
+}
+
+bool FVRInteractibleSimulation::IsEnabled()
+{
+	return VRInteractibleSimulationCVars::bBatchInteractibleTicks > 0;
+}
+
+FVRInteractibleWorldSimulation * FVRInteractibleSimulation::FindWorldSimulation(const UWorld * World) const
+{
+	const TUniquePtr<FVRInteractibleWorldSimulation> * WorldSimulation = World ? WorldSimulations.Find(FObjectKey(World)) : nullptr;
+	return WorldSimulation ? WorldSimulation->Get() : nullptr;
+}
+
+void FVRInteractibleSimulation::Wake(UActorComponent * Component)
+{
+	if (!Component)
+		return;
+
+	UWorld * World = Component->GetWorld();
+
+	if (!IsEnabled() || !World || !World->PersistentLevel)
+	{
+		// Switched modes while awake, don't step it twice
+		if (FVRInteractibleWorldSimulation * WorldSimulation = FindWorldSimulation(World))
+		{
+			WorldSimulation->Remove(Component);
+		}
+
+		Component->SetComponentTickEnabled(true);
+		return;
+	}
+
+	Component->SetComponentTickEnabled(false);
+
+	TUniquePtr<FVRInteractibleWorldSimulation> & WorldSimulation = WorldSimulations.FindOrAdd(FObjectKey(World));
+	if (!WorldSimulation.IsValid())
+	{
+		WorldSimulation = MakeUnique<FVRInteractibleWorldSimulation>(World);
+	}
+
+	WorldSimulation->Add(Component);
+}
+
+void FVRInteractibleSimulation::Sleep(UActorComponent * Component)
+{
+	if (!Component)
+		return;
+
+	Component->SetComponentTickEnabled(false);
+
+	if (FVRInteractibleWorldSimulation * WorldSimulation = FindWorldSimulation(Component->GetWorld()))
+	{
+		WorldSimulation->Remove(Component);
+	}
+}
+
+bool FVRInteractibleSimulation::IsAwake(const UActorComponent * Component) const
+{
+	if (!Component)
+		return false;
+
+	if (Component->IsComponentTickEnabled())
+		return true;
+
+	FVRInteractibleWorldSimulation * WorldSimulation = FindWorldSimulation(Component->GetWorld());
+	return WorldSimulation && WorldSimulation->ComponentIndices.Contains(const_cast<UActorComponent*>(Component));
+}
+
+int32 FVRInteractibleSimulation::GetNumAwake(const UWorld * World) const
+{
+	FVRInteractibleWorldSimulation * WorldSimulation = FindWorldSimulation(World);
+	return WorldSimulation ? WorldSimulation->Components.Num() : 0;
+}
+
+void FVRInteractibleSimulation::OnWorldCleanup(UWorld * World, bool bSessionEnded, bool bCleanupResources)
+{
+	// Unregisters the worlds tick function, components unregistered after this have nothing to remove themselves from
+	WorldSimulations.Remove(FObjectKey(World));
+}
@@ -1,6 +1,7 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "Interactibles/VRLeverComponent.h"
+#include "Interactibles/VRInteractibleSimulation.h"
 #include "Net/UnrealNetwork.h"
 
   //=============================================================================
@@ -131,7 +132,7 @@ void UVRLeverComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 
 			if (LerpedRot.Equals(FRotator::ZeroRotator))
 			{
-				this->SetComponentTickEnabled(false);
+				FVRInteractibleSimulation::Get().Sleep(this);
 				bIsLerping = false;
 				bReplicateMovement = true;
 				this->SetRelativeRotation((FTransform::Identity * InitialRelativeTransform).Rotator());
@@ -193,6 +194,7 @@ void UVRLeverComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 void UVRLeverComponent::OnUnregister()
 {
 	DestroyConstraint();
+	FVRInteractibleSimulation::Get().Sleep(this);
 	Super::OnUnregister();
 }
 
@@ -320,7 +322,7 @@ void UVRLeverComponent::OnGrip_Implementation(UGripMotionControllerComponent * G
 		bReplicateMovement = false;
 	}
 
-	this->SetComponentTickEnabled(true);
+	FVRInteractibleSimulation::Get().Wake(this);
 }
 
 void UVRLeverComponent::OnGripRelease_Implementation(UGripMotionControllerComponent * ReleasingController, const FBPActorGripInformation & GripInformation, bool bWasSocketed) 
@@ -338,7 +340,7 @@ void UVRLeverComponent::OnGripRelease_Implementation(UGripMotionControllerCompon
 	}
 	else
 	{
-		this->SetComponentTickEnabled(false);
+		FVRInteractibleSimulation::Get().Sleep(this);
 		bReplicateMovement = true;
 	}
 }
@@ -1,6 +1,7 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "Interactibles/VRSliderComponent.h"
+#include "Interactibles/VRInteractibleSimulation.h"
 #include "Net/UnrealNetwork.h"
 
   //=============================================================================
@@ -41,6 +42,8 @@ UVRSliderComponent::UVRSliderComponent(const FObjectInitializer& ObjectInitializ
 	bFollowSplineRotationAndScale = false;
 	SplineLerpType = EVRInteractibleSliderLerpType::Lerp_None;
 	SplineLerpValue = 8.f;
+	bUseSplineLookupTable = false;
+	SplineLookupMaxError = 0.1f;
 
 	GripPriority = 1;
 	LastSliderProgressState = -1.0f;
@@ -113,6 +116,32 @@ void UVRSliderComponent::BeginPlay()
 	}
 }
 
+float UVRSliderComponent::FindSplineInputKeyClosestToWorldLocation(const FVector & WorldLocation)
+{
+	if (bUseSplineLookupTable && SplineLookupTable.Update(SplineComponentToFollow, SplineLookupMaxError))
+	{
+		return SplineLookupTable.FindInputKeyClosestToWorldLocation(SplineComponentToFollow, WorldLocation);
+	}
+
+	return SplineComponentToFollow->FindInputKeyClosestToWorldLocation(WorldLocation);
+}
+
+float UVRSliderComponent::GetSplineInputKeyAtDistance(float Distance)
+{
+	if (bUseSplineLookupTable && SplineLookupTable.Update(SplineComponentToFollow, SplineLookupMaxError))
+	{
+		return SplineLookupTable.GetInputKeyAtDistance(Distance);
+	}
+
+	return SplineComponentToFollow->SplineCurves.ReparamTable.Eval(Distance, 0.0f);
+}
+
+void UVRSliderComponent::OnUnregister()
+{
+	FVRInteractibleSimulation::Get().Sleep(this);
+	Super::OnUnregister();
+}
+
 void UVRSliderComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	// Call supers tick (though I don't think any of the base classes to this actually implement it)
@@ -170,7 +199,7 @@ void UVRSliderComponent::TickComponent(float DeltaTime, enum ELevelTick TickType
 			OnSliderFinishedLerping.Broadcast(CurrentSliderProgress);
 			ReceiveSliderFinishedLerping(CurrentSliderProgress);
 
-			this->SetComponentTickEnabled(false);
+			FVRInteractibleSimulation::Get().Sleep(this);
 			bReplicateMovement = true;
 		}
 		
@@ -192,7 +221,7 @@ void UVRSliderComponent::TickGrip_Implementation(UGripMotionControllerComponent
 	if (SplineComponentToFollow != nullptr)
 	{
 		FVector WorldCalculatedLocation = CurrentRelativeTransform.TransformPosition(CalculatedLocation);
-		float ClosestKey = SplineComponentToFollow->FindInputKeyClosestToWorldLocation(WorldCalculatedLocation);
+		float ClosestKey = FindSplineInputKeyClosestToWorldLocation(WorldCalculatedLocation);
 
 		if (bSliderUsesSnapPoints)
 		{
@@ -205,7 +234,7 @@ void UVRSliderComponent::TickGrip_Implementation(UGripMotionControllerComponent
 
 			if (SplineComponentToFollow->SplineCurves.Position.Points.Num() > 1)
 			{
-				ClosestKey = SplineComponentToFollow->SplineCurves.ReparamTable.Eval(SplineProgress * SplineLength, 0.0f);
+				ClosestKey = GetSplineInputKeyAtDistance(SplineProgress * SplineLength);
 			}
 
 			WorldCalculatedLocation = SplineComponentToFollow->GetLocationAtSplineInputKey(ClosestKey, ESplineCoordinateSpace::World);
@@ -237,7 +266,7 @@ void UVRSliderComponent::TickGrip_Implementation(UGripMotionControllerComponent
 			}
 			else if (bLerpToNewKey)
 			{
-				trans = SplineComponentToFollow->FindTransformClosestToWorldLocation(WorldCalculatedLocation, ESplineCoordinateSpace::World, true);
+				trans = SplineComponentToFollow->GetTransformAtSplineInputKey(FindSplineInputKeyClosestToWorldLocation(WorldCalculatedLocation), ESplineCoordinateSpace::World, true);
 				bChangedLocation = true;
 			}
 
@@ -259,7 +288,7 @@ void UVRSliderComponent::TickGrip_Implementation(UGripMotionControllerComponent
 			}
 			else if (bLerpToNewKey)
 			{
-				WorldLocation = SplineComponentToFollow->FindLocationClosestToWorldLocation(WorldCalculatedLocation, ESplineCoordinateSpace::World);
+				WorldLocation = SplineComponentToFollow->GetLocationAtSplineInputKey(FindSplineInputKeyClosestToWorldLocation(WorldCalculatedLocation), ESplineCoordinateSpace::World);
 				bChangedLocation = true;
 			}
 
@@ -368,11 +397,11 @@ void UVRSliderComponent::OnGripRelease_Implementation(UGripMotionControllerCompo
 	if (SliderBehaviorWhenReleased != EVRInteractibleSliderDropBehavior::Stay)
 	{
 		bIsLerping = true;
-		this->SetComponentTickEnabled(true);
+		FVRInteractibleSimulation::Get().Wake(this);
 	}
 	else
 	{
-		this->SetComponentTickEnabled(false);
+		FVRInteractibleSimulation::Get().Sleep(this);
 		bReplicateMovement = true;
 	}
 }
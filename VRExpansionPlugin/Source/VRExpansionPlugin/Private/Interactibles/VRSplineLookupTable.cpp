@@ -0,0 +1,189 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interactibles/VRSplineLookupTable.h"
+#include "Components/SplineComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("SplineLookupTable ~ Build"), STAT_SplineLookupTableBuild, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("SplineLookupTable ~ FindClosest"), STAT_SplineLookupTableFindClosest, STATGROUP_Game);
+
+// Starting density and hard cap on the number of samples, the cap wins over the error bound
+static const int32 SplineLookupInitialSamplesPerSegment = 4;
+static const int32 SplineLookupMaxSamples = 4096;
+
+// Segments per chunk of the coarse closest point search
+static const int32 SplineLookupSegmentsPerChunk = 32;
+
+FVRSplineLookupTable::FVRSplineLookupTable() :
+	SampleDistance(0.0f),
+	MeasuredError(0.0f),
+	MaxError(0.0f),
+	NumSplinePoints(0),
+	bClosedLoop(false),
+	SplineLength(0.0f)
+{
+}
+
+void FVRSplineLookupTable::Reset()
+{
+	Positions.Reset();
+	InputKeys.Reset();
+	ChunkBounds.Reset();
+	SampleDistance = 0.0f;
+	MeasuredError = 0.0f;
+	Spline.Reset();
+}
+
+bool FVRSplineLookupTable::Update(const USplineComponent * InSpline, float InMaxError)
+{
+	if (!InSpline)
+	{
+		Reset();
+		return false;
+	}
+
+	// There is no change notification on splines, anything that moves a point changes the length
+	if (Spline.Get() != InSpline || MaxError != InMaxError || NumSplinePoints != InSpline->GetNumberOfSplinePoints() ||
+		bClosedLoop != InSpline->IsClosedLoop() || SplineLength != InSpline->GetSplineLength())
+	{
+		Build(InSpline, InMaxError);
+	}
+
+	return IsValid();
+}
+
+void FVRSplineLookupTable::Build(const USplineComponent * InSpline, float InMaxError)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SplineLookupTableBuild);
+
+	Reset();
+
+	Spline = InSpline;
+	MaxError = InMaxError;
+	NumSplinePoints = InSpline->GetNumberOfSplinePoints();
+	bClosedLoop = InSpline->IsClosedLoop();
+	SplineLength = InSpline->GetSplineLength();
+
+	const int32 NumSegments = bClosedLoop ? NumSplinePoints : NumSplinePoints - 1;
+	if (NumSegments < 1 || SplineLength <= 0.0f)
+		return;
+
+	const FInterpCurveFloat & ReparamTable = InSpline->SplineCurves.ReparamTable;
+	int32 NumIntervals = FMath::Min(NumSegments * SplineLookupInitialSamplesPerSegment, SplineLookupMaxSamples - 1);
+
+	for (;;)
+	{
+		SampleDistance = SplineLength / NumIntervals;
+		Positions.SetNumUninitialized(NumIntervals + 1);
+		InputKeys.SetNumUninitialized(NumIntervals + 1);
+
+		for (int32 i = 0; i <= NumIntervals; ++i)
+		{
+			InputKeys[i] = ReparamTable.Eval(SampleDistance * i, 0.0f);
+			Positions[i] = InSpline->GetLocationAtSplineInputKey(InputKeys[i], ESplineCoordinateSpace::Local);
+		}
+
+		// Check the curve half way between each pair of samples against the straight line
+		MeasuredError = 0.0f;
+		for (int32 i = 0; i < NumIntervals; ++i)
+		{
+			const float MidKey = ReparamTable.Eval(SampleDistance * (i + 0.5f), 0.0f);
+			const FVector MidLocation = InSpline->GetLocationAtSplineInputKey(MidKey, ESplineCoordinateSpace::Local);
+			MeasuredError = FMath::Max(MeasuredError, FVector::Dist(MidLocation, (Positions[i] + Positions[i + 1]) * 0.5f));
+		}
+
+		if (MeasuredError <= MaxError || NumIntervals * 2 >= SplineLookupMaxSamples)
+			break;
+
+		NumIntervals *= 2;
+	}
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumIntervals, SplineLookupSegmentsPerChunk);
+	ChunkBounds.SetNumUninitialized(NumChunks);
+
+	for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+	{
+		const int32 LastSample = FMath::Min((Chunk + 1) * SplineLookupSegmentsPerChunk, NumIntervals);
+
+		ChunkBounds[Chunk] = FBox(ForceInit);
+		for (int32 i = Chunk * SplineLookupSegmentsPerChunk; i <= LastSample; ++i)
+		{
+			ChunkBounds[Chunk] += Positions[i];
+		}
+	}
+}
+
+void FVRSplineLookupTable::FindClosestInChunk(int32 Chunk, const FVector & LocalLocation, int32 & ClosestIndex, float & ClosestAlpha, float & ClosestDistSq) const
+{
+	const int32 EndIndex = FMath::Min((Chunk + 1) * SplineLookupSegmentsPerChunk, Positions.Num() - 1);
+	for (int32 i = Chunk * SplineLookupSegmentsPerChunk; i < EndIndex; ++i)
+	{
+		const FVector Start = Positions[i];
+		const FVector Segment = Positions[i + 1] - Start;
+		const float SegmentSizeSq = Segment.SizeSquared();
+		const float Alpha = SegmentSizeSq > SMALL_NUMBER ? FMath::Clamp(FVector::DotProduct(LocalLocation - Start, Segment) / SegmentSizeSq, 0.0f, 1.0f) : 0.0f;
+		const float DistSq = FVector::DistSquared(Start + Segment * Alpha, LocalLocation);
+
+		if (DistSq < ClosestDistSq)
+		{
+			ClosestDistSq = DistSq;
+			ClosestIndex = i;
+			ClosestAlpha = Alpha;
+		}
+	}
+}
+
+float FVRSplineLookupTable::FindInputKeyClosestToWorldLocation(const USplineComponent * InSpline, const FVector & WorldLocation, float * OutDistance) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_SplineLookupTableFindClosest);
+	check(IsValid());
+
+	// Same space as the splines own search
+	const FVector LocalLocation = InSpline->GetComponentTransform().InverseTransformPosition(WorldLocation);
+
+	int32 ClosestIndex = 0;
+	float ClosestAlpha = 0.0f;
+	float ClosestDistSq = BIG_NUMBER;
+
+	// Refine the chunk with the closest bounds first, most of the others can then be skipped on their bounds alone
+	const int32 NumChunks = ChunkBounds.Num();
+	int32 FirstChunk = 0;
+	float FirstChunkDistSq = BIG_NUMBER;
+
+	for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+	{
+		const float BoundsDistSq = ChunkBounds[Chunk].ComputeSquaredDistanceToPoint(LocalLocation);
+		if (BoundsDistSq < FirstChunkDistSq)
+		{
+			FirstChunkDistSq = BoundsDistSq;
+			FirstChunk = Chunk;
+		}
+	}
+
+	FindClosestInChunk(FirstChunk, LocalLocation, ClosestIndex, ClosestAlpha, ClosestDistSq);
+
+	for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+	{
+		if (Chunk != FirstChunk && ChunkBounds[Chunk].ComputeSquaredDistanceToPoint(LocalLocation) < ClosestDistSq)
+		{
+			FindClosestInChunk(Chunk, LocalLocation, ClosestIndex, ClosestAlpha, ClosestDistSq);
+		}
+	}
+
+	if (OutDistance)
+	{
+		*OutDistance = (ClosestIndex + ClosestAlpha) * SampleDistance;
+	}
+
+	return FMath::Lerp(InputKeys[ClosestIndex], InputKeys[ClosestIndex + 1], ClosestAlpha);
+}
+
+float FVRSplineLookupTable::GetInputKeyAtDistance(float Distance) const
+{
+	check(IsValid());
+
+	const int32 NumIntervals = Positions.Num() - 1;
+	const float Sample = FMath::Clamp(Distance / SampleDistance, 0.0f, (float)NumIntervals);
+	const int32 Index = FMath::Min(FMath::FloorToInt(Sample), NumIntervals - 1);
+
+	return FMath::Lerp(InputKeys[Index], InputKeys[Index + 1], Sample - Index);
+}
@@ -5,12 +5,14 @@
 #include "EngineGlobals.h"
 #include "CollisionQueryParams.h"
 #include "Engine/Engine.h"
+#include "Engine/World.h"
 #include "AIModule/Classes/AISystem.h"
 #include "AIModule/Classes/Perception/AIPerceptionComponent.h"
 #include "VisualLogger/VisualLogger.h"
 #include "AIModule/Classes/Perception/AISightTargetInterface.h"
 #include "AIModule/Classes/Perception/AISenseConfig_Sight.h"
 #include "AIModule/Classes/Perception/AIPerceptionSystem.h"
+#include "Async/ParallelFor.h"
 
 #if WITH_GAMEPLAY_DEBUGGER
 #include "GameplayDebugger/Public/GameplayDebuggerTypes.h"
@@ -34,10 +36,22 @@ DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Listener Update"), STAT_AI_Sen
 DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Register Target"), STAT_AI_Sense_Sight_RegisterTarget, STATGROUP_AI);
 DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Remove By Listener"), STAT_AI_Sense_Sight_RemoveByListener, STATGROUP_AI);
 DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Remove To Target"), STAT_AI_Sense_Sight_RemoveToTarget, STATGROUP_AI);
+DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Submit Batched"), STAT_AI_Sense_Sight_SubmitBatched, STATGROUP_AI);
+DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Consume Async Traces"), STAT_AI_Sense_Sight_ConsumeAsync, STATGROUP_AI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Perception Sense: Sight, Async Traces"), STAT_AI_Sense_Sight_AsyncTraces, STATGROUP_AI);
+DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Gather Queries"), STAT_AI_Sense_Sight_Gather, STATGROUP_AI);
+DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Score Queries"), STAT_AI_Sense_Sight_Score, STATGROUP_AI);
+DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Select Queries"), STAT_AI_Sense_Sight_Select, STATGROUP_AI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Perception Sense: Sight, Queries"), STAT_AI_Sense_Sight_Queries, STATGROUP_AI);
 
 
 static const int32 DefaultMaxTracesPerTick = 6;
 static const int32 DefaultMinQueriesPerTimeSliceCheck = 40;
+static const int32 DefaultMaxAsyncTracesPerTick = 64;
+static const int32 DefaultMinQueriesForParallelScoring = 1024;
+
+// Queries scored per ParallelFor task
+static const int32 SightScoringChunkSize = 256;
 
 //----------------------------------------------------------------------//
 // helpers
@@ -53,13 +67,18 @@ FORCEINLINE_DEBUGGABLE bool CheckIsTargetInSightPie(const FPerceptionListener& L
 	return false;
 }
 
+FORCEINLINE uint64 MakeSightQueryKey(uint32 ObserverId, FAISightTargetVR::FTargetId TargetId)
+{
+	return ((uint64)ObserverId << 32) | (uint64)TargetId;
+}
+
 //----------------------------------------------------------------------//
 // FAISightTargetVR
 //----------------------------------------------------------------------//
 const FAISightTargetVR::FTargetId FAISightTargetVR::InvalidTargetId = FAISystem::InvalidUnsignedID;
 
 FAISightTargetVR::FAISightTargetVR(AActor* InTarget, FGenericTeamId InTeamId)
-	: Target(InTarget), SightTargetInterface(NULL), TeamId(InTeamId)
+	: Target(InTarget), SightTargetInterface(NULL), TeamId(InTeamId), CachedLocation(FVector::ZeroVector)
 {
 	if (InTarget)
 	{
@@ -99,6 +118,10 @@ UAISense_Sight_VR::UAISense_Sight_VR(const FObjectInitializer& ObjectInitializer
 	, HighImportanceQueryDistanceThreshold(300.f)
 	, MaxQueryImportance(60.f)
 	, SightLimitQueryImportance(10.f)
+	, bUseAsyncSightTraces(false)
+	, MaxAsyncTracesPerTick(DefaultMaxAsyncTracesPerTick)
+	, bUseQuerySelection(false)
+	, MinQueriesForParallelScoring(DefaultMinQueriesForParallelScoring)
 {
 	if (HasAnyFlags(RF_ClassDefaultObject) == false)
 	{
@@ -120,7 +143,11 @@ UAISense_Sight_VR::UAISense_Sight_VR(const FObjectInitializer& ObjectInitializer
 
 FORCEINLINE_DEBUGGABLE float UAISense_Sight_VR::CalcQueryImportance(const FPerceptionListener& Listener, const FVector& TargetLocation, const float SightRadiusSq) const
 {
-	const float DistanceSq = FVector::DistSquared(Listener.CachedLocation, TargetLocation);
+	return CalcQueryImportance(FVector::DistSquared(Listener.CachedLocation, TargetLocation), SightRadiusSq);
+}
+
+FORCEINLINE_DEBUGGABLE float UAISense_Sight_VR::CalcQueryImportance(const float DistanceSq, const float SightRadiusSq) const
+{
 	return DistanceSq <= HighImportanceDistanceSquare ? MaxQueryImportance
 		: FMath::Clamp((SightLimitQueryImportance - MaxQueryImportance) / SightRadiusSq * DistanceSq + MaxQueryImportance, 0.f, MaxQueryImportance);
 }
@@ -150,7 +177,7 @@ float UAISense_Sight_VR::Update()
 {
 	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight);
 
-	const UWorld* World = GEngine->GetWorldFromContextObject(GetPerceptionSystem()->GetOuter(), EGetWorldErrorMode::LogAndReturnNull);
+	UWorld* World = GEngine->GetWorldFromContextObject(GetPerceptionSystem()->GetOuter(), EGetWorldErrorMode::LogAndReturnNull);
 
 	if (World == NULL)
 	{
@@ -174,8 +201,30 @@ float UAISense_Sight_VR::Update()
 
 	AIPerception::FListenerMap& ListenersMap = *GetListeners();
 
+	// Also drains traces left over if async traces were just turned off
+	if (PendingSightTraces.Num() > 0)
+	{
+		ConsumeAsyncSightTraces(World);
+	}
+
+	SET_DWORD_STAT(STAT_AI_Sense_Sight_Queries, SightQueryQueue.Num());
+
+	const bool bSelectQueries = bUseQuerySelection && !bUseAsyncSightTraces;
+
+	if (bUseAsyncSightTraces)
+	{
+		NumQueriesProcessed = SubmitBatchedQueries(World, InvalidQueries, InvalidTargets);
+	}
+	else if (bSelectQueries)
+	{
+		NumQueriesProcessed = UpdateSelectedQueries(World, InvalidQueries, InvalidTargets, bHitTimeSliceLimit);
+	}
+
+	// The batched and selection paths have already gone through the whole queue
+	const int32 NumSyncQueries = (bUseAsyncSightTraces || bSelectQueries) ? 0 : SightQueryQueue.Num();
+
 	FAISightQueryVR* SightQuery = SightQueryQueue.GetData();
-	for (int32 QueryIndex = 0; QueryIndex < SightQueryQueue.Num(); ++QueryIndex, ++SightQuery)
+	for (int32 QueryIndex = 0; QueryIndex < NumSyncQueries; ++QueryIndex, ++SightQuery)
 	{
 		// Time slice limit check - spread out checks to every N queries so we don't spend more time checking timer than doing work
 		NumQueriesProcessed++;
@@ -343,7 +392,8 @@ float UAISense_Sight_VR::Update()
 		}
 	}
 
-	// sort Sight Queries
+	// sort Sight Queries, the selection pass doesn't depend on the queue order
+	if (!bSelectQueries)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight_UpdateSort);
 		SortQueries();
@@ -353,6 +403,468 @@ float UAISense_Sight_VR::Update()
 	return 0.f;
 }
 
+void UAISense_Sight_VR::FSightQueryBatch::Reset()
+{
+	QueryIndices.Reset();
+	Listeners.Reset();
+	Targets.Reset();
+	ListenerLocations.Reset();
+	ListenerDirections.Reset();
+	TargetLocations.Reset();
+	SightRadiusSq.Reset();
+	PeripheralVisionAngleCos.Reset();
+	InSightPie.Reset();
+	Digests.Reset();
+	Scores.Reset();
+	Importance.Reset();
+	Selected.Reset();
+	Handled.Reset();
+}
+
+int32 UAISense_Sight_VR::UpdateSelectedQueries(UWorld* World, TArray<int32>& InvalidQueries, TArray<FAISightTargetVR::FTargetId>& InvalidTargets, bool& bOutHitTimeSliceLimit)
+{
+	AIPerception::FListenerMap& ListenersMap = *GetListeners();
+
+	FSightQueryBatch& Batch = SightQueryBatch;
+	Batch.Reset();
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight_Gather);
+
+		// Once per target instead of once per query, also saves the VR character casts
+		for (FTargetsContainer::TIterator ItTarget(ObservedTargets); ItTarget; ++ItTarget)
+		{
+			ItTarget->Value.CachedLocation = ItTarget->Value.GetLocationSimple();
+		}
+
+		for (int32 QueryIndex = 0; QueryIndex < SightQueryQueue.Num(); ++QueryIndex)
+		{
+			const FAISightQueryVR& SightQuery = SightQueryQueue[QueryIndex];
+
+			FPerceptionListener* Listener = ListenersMap.Find(SightQuery.ObserverId);
+			FAISightTargetVR* Target = ObservedTargets.Find(SightQuery.TargetId);
+
+			const bool bTargetValid = Target && Target->Target.IsValid();
+			const bool bListenerValid = Listener && Listener->Listener.IsValid();
+
+			if (!bTargetValid || !bListenerValid)
+			{
+				InvalidQueries.Add(QueryIndex);
+				if (bTargetValid == false)
+				{
+					InvalidTargets.AddUnique(SightQuery.TargetId);
+				}
+				continue;
+			}
+
+			const FDigestedSightProperties& PropDigest = DigestedProperties[SightQuery.ObserverId];
+
+			Batch.QueryIndices.Add(QueryIndex);
+			Batch.Listeners.Add(Listener);
+			Batch.Targets.Add(Target);
+			Batch.Digests.Add(&PropDigest);
+			Batch.ListenerLocations.Add(Listener->CachedLocation);
+			Batch.ListenerDirections.Add(Listener->CachedDirection);
+			Batch.TargetLocations.Add(Target->CachedLocation);
+			Batch.SightRadiusSq.Add(SightQuery.bLastResult ? PropDigest.LoseSightRadiusSq : PropDigest.SightRadiusSq);
+			Batch.PeripheralVisionAngleCos.Add(PropDigest.PeripheralVisionAngleCos);
+			Batch.Scores.Add(SightQuery.Score);
+		}
+	}
+
+	const int32 BatchSize = Batch.Num();
+	Batch.InSightPie.SetNumUninitialized(BatchSize);
+	Batch.Importance.SetNumUninitialized(BatchSize);
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight_Score);
+
+		// Sight pie test and the importance the query gets if it is processed, only touches the batch arrays
+		const int32 NumChunks = FMath::DivideAndRoundUp(BatchSize, SightScoringChunkSize);
+		ParallelFor(NumChunks, [this, &Batch, BatchSize](int32 ChunkIndex)
+		{
+			const int32 ChunkEnd = FMath::Min((ChunkIndex + 1) * SightScoringChunkSize, BatchSize);
+			for (int32 i = ChunkIndex * SightScoringChunkSize; i < ChunkEnd; ++i)
+			{
+				const FVector ToTarget = Batch.TargetLocations[i] - Batch.ListenerLocations[i];
+				const float DistSq = ToTarget.SizeSquared();
+				const float Dot = FVector::DotProduct(ToTarget, Batch.ListenerDirections[i]);
+				Batch.InSightPie[i] = (uint8)(DistSq <= Batch.SightRadiusSq[i]) & (uint8)(Dot > Batch.PeripheralVisionAngleCos[i] * FMath::Sqrt(DistSq));
+				Batch.Importance[i] = CalcQueryImportance(DistSq, Batch.SightRadiusSq[i]);
+			}
+		}, BatchSize < MinQueriesForParallelScoring);
+	}
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight_Select);
+
+		// Only queries in the sight pie need a line of sight check, keep the highest scored of them in a min heap bounded to the trace budget
+		const TArray<float>& Scores = Batch.Scores;
+		auto LowerScore = [&Scores](int32 A, int32 B) { return Scores[A] < Scores[B]; };
+		const int32 MaxSelected = FMath::Max(MaxTracesPerTick, 0);
+
+		for (int32 i = 0; i < BatchSize && MaxSelected > 0; ++i)
+		{
+			if (!Batch.InSightPie[i])
+			{
+				continue;
+			}
+
+			if (Batch.Selected.Num() < MaxSelected)
+			{
+				Batch.Selected.HeapPush(i, LowerScore);
+			}
+			else if (Scores[i] > Scores[Batch.Selected.HeapTop()])
+			{
+				Batch.Selected.HeapPopDiscard(LowerScore, /*bAllowShrinking*/false);
+				Batch.Selected.HeapPush(i, LowerScore);
+			}
+		}
+
+		// Most due first, same order the sorted queue used to be processed in
+		Batch.Selected.Sort([&Scores](int32 A, int32 B) { return Scores[A] > Scores[B]; });
+	}
+
+	Batch.Handled.Init(false, BatchSize);
+
+	int32 TracesCount = 0;
+	const double TimeSliceEnd = FPlatformTime::Seconds() + MaxTimeSlicePerTick;
+	for (const int32 i : Batch.Selected)
+	{
+		if (TracesCount >= MaxTracesPerTick)
+		{
+			break;
+		}
+
+		// Few enough of these to check the time on every one
+		if (FPlatformTime::Seconds() > TimeSliceEnd)
+		{
+			bOutHitTimeSliceLimit = true;
+			break;
+		}
+
+		FAISightQueryVR& SightQuery = SightQueryQueue[Batch.QueryIndices[i]];
+		TracesCount += CheckLineOfSight(World, *Batch.Digests[i], *Batch.Listeners[i], *Batch.Targets[i], SightQuery, Batch.TargetLocations[i]);
+
+		SightQuery.Importance = Batch.Importance[i];
+		SightQuery.Age = 0.f;
+		Batch.Handled[i] = true;
+	}
+
+	int32 NumCulledResolved = 0;
+	for (int32 i = 0; i < BatchSize; ++i)
+	{
+		FAISightQueryVR& SightQuery = SightQueryQueue[Batch.QueryIndices[i]];
+
+		// Culled queries cost no traces but still count against the time slice, spread out checks like the serial path
+		if (!Batch.InSightPie[i] && !bOutHitTimeSliceLimit && (++NumCulledResolved % MinQueriesPerTimeSliceCheck) == 0 && FPlatformTime::Seconds() > TimeSliceEnd)
+		{
+			bOutHitTimeSliceLimit = true;
+		}
+
+		if (Batch.InSightPie[i] || bOutHitTimeSliceLimit)
+		{
+			if (!Batch.Handled[i])
+			{
+				// age unprocessed queries so that they can be selected during next update
+				SightQuery.Age += 1.f;
+			}
+		}
+		else
+		{
+			// Culled by the sight pie, resolved without waiting for their turn in the queue
+			FPerceptionListener& Listener = *Batch.Listeners[i];
+			AActor* TargetActor = Batch.Targets[i]->Target.Get();
+			float StimulusStrength = 1.f;
+
+			// @Note that automagical "seeing" does not care about sight range nor vision cone
+			if (ShouldAutomaticallySeeTarget(*Batch.Digests[i], &SightQuery, Listener, TargetActor, StimulusStrength))
+			{
+				Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, StimulusStrength, SightQuery.LastSeenLocation, Listener.CachedLocation));
+				SightQuery.bLastResult = true;
+			}
+			// communicate failure only if we've seen give actor before
+			else if (SightQuery.bLastResult)
+			{
+				SIGHT_LOG_SEGMENTVR(Listener.Listener.Get()->GetOwner(), Listener.CachedLocation, Batch.TargetLocations[i], FColor::Red, TEXT("%u"), SightQuery.TargetId);
+				Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, Batch.TargetLocations[i], Listener.CachedLocation, FAIStimulus::SensingFailed));
+				SightQuery.bLastResult = false;
+			}
+
+			SightQuery.Importance = Batch.Importance[i];
+			SightQuery.Age = 0.f;
+		}
+
+		SightQuery.RecalcScore();
+	}
+
+	return BatchSize;
+}
+
+int32 UAISense_Sight_VR::CheckLineOfSight(UWorld* World, const FDigestedSightProperties& PropDigest, FPerceptionListener& Listener, FAISightTargetVR& Target, FAISightQueryVR& SightQuery, const FVector& TargetLocation)
+{
+	AActor* TargetActor = Target.Target.Get();
+	float StimulusStrength = 1.f;
+
+	// @Note that automagical "seeing" does not care about sight range nor vision cone
+	if (ShouldAutomaticallySeeTarget(PropDigest, &SightQuery, Listener, TargetActor, StimulusStrength))
+	{
+		// Pretend like we've seen this target where we last saw them
+		Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, StimulusStrength, SightQuery.LastSeenLocation, Listener.CachedLocation));
+		SightQuery.bLastResult = true;
+		return 0;
+	}
+
+	SIGHT_LOG_SEGMENTVR(Listener.Listener.Get()->GetOwner(), Listener.CachedLocation, TargetLocation, FColor::Green, TEXT("%u"), SightQuery.TargetId);
+
+	if (Target.SightTargetInterface != NULL)
+	{
+		FVector OutSeenLocation(0.f);
+		int32 NumberOfLoSChecksPerformed = 0;
+		const bool bVisible = Target.SightTargetInterface->CanBeSeenFrom(Listener.CachedLocation, OutSeenLocation, NumberOfLoSChecksPerformed, StimulusStrength, Listener.Listener->GetBodyActor());
+		ApplySightResult(Listener, TargetActor, SightQuery, bVisible, OutSeenLocation, TargetLocation, StimulusStrength);
+		return NumberOfLoSChecksPerformed;
+	}
+
+	// we need to do tests ourselves
+	FHitResult HitResult;
+	const bool bHit = World->LineTraceSingleByChannel(HitResult, Listener.CachedLocation, TargetLocation
+		, DefaultSightCollisionChannel
+		, FCollisionQueryParams(SCENE_QUERY_STAT(AILineOfSight), true, Listener.Listener->GetBodyActor()));
+
+	const bool bVisible = bHit == false || (HitResult.Actor.IsValid() && HitResult.Actor->IsOwnedBy(TargetActor));
+	ApplySightResult(Listener, TargetActor, SightQuery, bVisible, TargetLocation, TargetLocation, 1.f);
+	return 1;
+}
+
+int32 UAISense_Sight_VR::SubmitBatchedQueries(UWorld* World, TArray<int32>& InvalidQueries, TArray<FAISightTargetVR::FTargetId>& InvalidTargets)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight_SubmitBatched);
+
+	AIPerception::FListenerMap& ListenersMap = *GetListeners();
+	const int32 MaxBatchSize = FMath::Max(MaxAsyncTracesPerTick - PendingSightTraces.Num(), 0);
+	int32 NumQueriesProcessed = 0;
+
+	FSightQueryBatch& Batch = SightQueryBatch;
+	Batch.Reset();
+
+	// The queue is sorted by score, so the first queries found are the most due
+	for (int32 QueryIndex = 0; QueryIndex < SightQueryQueue.Num(); ++QueryIndex)
+	{
+		FAISightQueryVR& SightQuery = SightQueryQueue[QueryIndex];
+		NumQueriesProcessed++;
+
+		// Rescored when its trace comes back
+		if (SightQuery.bTracePending)
+		{
+			continue;
+		}
+
+		if (Batch.Num() >= MaxBatchSize)
+		{
+			// age unprocessed queries so that they can advance in the queue during next sort
+			SightQuery.Age += 1.f;
+			SightQuery.RecalcScore();
+			continue;
+		}
+
+		FPerceptionListener* Listener = ListenersMap.Find(SightQuery.ObserverId);
+		FAISightTargetVR* Target = ObservedTargets.Find(SightQuery.TargetId);
+
+		const bool bTargetValid = Target && Target->Target.IsValid();
+		const bool bListenerValid = Listener && Listener->Listener.IsValid();
+
+		if (!bTargetValid || !bListenerValid)
+		{
+			InvalidQueries.Add(QueryIndex);
+			if (bTargetValid == false)
+			{
+				InvalidTargets.AddUnique(SightQuery.TargetId);
+			}
+			continue;
+		}
+
+		AActor* TargetActor = Target->Target.Get();
+		const FVector TargetLocation = Target->GetLocationSimple();
+		const FDigestedSightProperties& PropDigest = DigestedProperties[SightQuery.ObserverId];
+		const float SightRadiusSq = SightQuery.bLastResult ? PropDigest.LoseSightRadiusSq : PropDigest.SightRadiusSq;
+
+		// @Note that automagical "seeing" does not care about sight range nor vision cone
+		float StimulusStrength = 1.f;
+		if (ShouldAutomaticallySeeTarget(PropDigest, &SightQuery, *Listener, TargetActor, StimulusStrength))
+		{
+			Listener->RegisterStimulus(TargetActor, FAIStimulus(*this, StimulusStrength, SightQuery.LastSeenLocation, Listener->CachedLocation));
+			SightQuery.bLastResult = true;
+			SightQuery.Importance = CalcQueryImportance(*Listener, TargetLocation, SightRadiusSq);
+			SightQuery.Age = 0.f;
+			SightQuery.RecalcScore();
+			continue;
+		}
+
+		Batch.QueryIndices.Add(QueryIndex);
+		Batch.Listeners.Add(Listener);
+		Batch.Targets.Add(Target);
+		Batch.ListenerLocations.Add(Listener->CachedLocation);
+		Batch.ListenerDirections.Add(Listener->CachedDirection);
+		Batch.TargetLocations.Add(TargetLocation);
+		Batch.SightRadiusSq.Add(SightRadiusSq);
+		Batch.PeripheralVisionAngleCos.Add(PropDigest.PeripheralVisionAngleCos);
+	}
+
+	// Sight pie test for the whole batch in one branch free pass, compares against the cone without normalizing the direction
+	const int32 BatchSize = Batch.Num();
+	Batch.InSightPie.SetNumUninitialized(BatchSize);
+	for (int32 i = 0; i < BatchSize; ++i)
+	{
+		const FVector ToTarget = Batch.TargetLocations[i] - Batch.ListenerLocations[i];
+		const float DistSq = ToTarget.SizeSquared();
+		const float Dot = FVector::DotProduct(ToTarget, Batch.ListenerDirections[i]);
+		Batch.InSightPie[i] = (uint8)(DistSq <= Batch.SightRadiusSq[i]) & (uint8)(Dot > Batch.PeripheralVisionAngleCos[i] * FMath::Sqrt(DistSq));
+	}
+
+	for (int32 i = 0; i < BatchSize; ++i)
+	{
+		FAISightQueryVR& SightQuery = SightQueryQueue[Batch.QueryIndices[i]];
+		FPerceptionListener& Listener = *Batch.Listeners[i];
+		FAISightTargetVR& Target = *Batch.Targets[i];
+		AActor* TargetActor = Target.Target.Get();
+		const FVector& TargetLocation = Batch.TargetLocations[i];
+
+		if (!Batch.InSightPie[i])
+		{
+			// communicate failure only if we've seen give actor before
+			if (SightQuery.bLastResult)
+			{
+				Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
+				SightQuery.bLastResult = false;
+			}
+		}
+		else if (Target.SightTargetInterface != NULL)
+		{
+			// Targets with their own visibility test can't be deferred
+			FVector OutSeenLocation(0.f);
+			int32 NumberOfLoSChecksPerformed = 0;
+			float StimulusStrength = 1.f;
+			const bool bVisible = Target.SightTargetInterface->CanBeSeenFrom(Listener.CachedLocation, OutSeenLocation, NumberOfLoSChecksPerformed, StimulusStrength, Listener.Listener->GetBodyActor());
+			ApplySightResult(Listener, TargetActor, SightQuery, bVisible, OutSeenLocation, TargetLocation, StimulusStrength);
+		}
+		else
+		{
+			FAISightPendingTraceVR& PendingTrace = PendingSightTraces[PendingSightTraces.AddUninitialized()];
+			PendingTrace.TraceHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Listener.CachedLocation, TargetLocation
+				, DefaultSightCollisionChannel
+				, FCollisionQueryParams(SCENE_QUERY_STAT(AILineOfSight), true, Listener.Listener->GetBodyActor()));
+			PendingTrace.ObserverId = SightQuery.ObserverId;
+			PendingTrace.TargetId = SightQuery.TargetId;
+			PendingTrace.TargetLocation = TargetLocation;
+			PendingTrace.SightRadiusSq = Batch.SightRadiusSq[i];
+			PendingTrace.SubmitFrame = GFrameCounter;
+
+			SightQuery.bTracePending = true;
+			INC_DWORD_STAT(STAT_AI_Sense_Sight_AsyncTraces);
+			continue;
+		}
+
+		SightQuery.Importance = CalcQueryImportance(Listener, TargetLocation, Batch.SightRadiusSq[i]);
+		SightQuery.Age = 0.f;
+		SightQuery.RecalcScore();
+	}
+
+	return NumQueriesProcessed;
+}
+
+void UAISense_Sight_VR::ConsumeAsyncSightTraces(UWorld* World)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight_ConsumeAsync);
+
+	// The queue has been sorted since the traces went out, find them again by observer / target pair
+	PendingSightTraceLookup.Reset();
+	for (int32 i = 0; i < PendingSightTraces.Num(); ++i)
+	{
+		PendingSightTraceLookup.Add(MakeSightQueryKey(PendingSightTraces[i].ObserverId, PendingSightTraces[i].TargetId), i);
+	}
+
+	AIPerception::FListenerMap& ListenersMap = *GetListeners();
+
+	for (FAISightQueryVR& SightQuery : SightQueryQueue)
+	{
+		if (!SightQuery.bTracePending)
+		{
+			continue;
+		}
+
+		const int32* PendingIndex = PendingSightTraceLookup.Find(MakeSightQueryKey(SightQuery.ObserverId, SightQuery.TargetId));
+		if (PendingIndex == nullptr)
+		{
+			SightQuery.bTracePending = false;
+			continue;
+		}
+
+		const FAISightPendingTraceVR& PendingTrace = PendingSightTraces[*PendingIndex];
+
+		// Async traces run during the frame they were requested in, results are ready on the next one
+		if (PendingTrace.SubmitFrame == GFrameCounter)
+		{
+			continue;
+		}
+
+		SightQuery.bTracePending = false;
+
+		// A lost trace just puts the query back in the queue
+		FTraceDatum TraceDatum;
+		if (!World->QueryTraceData(PendingTrace.TraceHandle, TraceDatum))
+		{
+			continue;
+		}
+
+		// Invalid pairs are removed by the next pass over the queue
+		FPerceptionListener* Listener = ListenersMap.Find(SightQuery.ObserverId);
+		FAISightTargetVR* Target = ObservedTargets.Find(SightQuery.TargetId);
+		if (!Listener || !Listener->Listener.IsValid() || !Target || !Target->Target.IsValid())
+		{
+			continue;
+		}
+
+		AActor* TargetActor = Target->Target.Get();
+		const FHitResult* Hit = FHitResult::GetFirstBlockingHit(TraceDatum.OutHits);
+		const bool bVisible = Hit == nullptr || (Hit->Actor.IsValid() && Hit->Actor->IsOwnedBy(TargetActor));
+
+		ApplySightResult(*Listener, TargetActor, SightQuery, bVisible, PendingTrace.TargetLocation, PendingTrace.TargetLocation, 1.f);
+
+		SightQuery.Importance = CalcQueryImportance(*Listener, PendingTrace.TargetLocation, PendingTrace.SightRadiusSq);
+		SightQuery.Age = 0.f;
+		SightQuery.RecalcScore();
+	}
+
+	// Only traces from this frame are still outstanding
+	PendingSightTraces.RemoveAllSwap([](const FAISightPendingTraceVR& PendingTrace)
+	{
+		return PendingTrace.SubmitFrame != GFrameCounter;
+	}, /*bAllowShrinking*/false);
+}
+
+void UAISense_Sight_VR::ApplySightResult(FPerceptionListener& Listener, AActor* TargetActor, FAISightQueryVR& SightQuery, bool bVisible, const FVector& SeenLocation, const FVector& TargetLocation, float StimulusStrength)
+{
+	if (bVisible)
+	{
+		Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, StimulusStrength, SeenLocation, Listener.CachedLocation));
+		SightQuery.bLastResult = true;
+		SightQuery.LastSeenLocation = SeenLocation;
+	}
+	// communicate failure only if we've seen give actor before
+	else if (SightQuery.bLastResult == true)
+	{
+		Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
+		SightQuery.bLastResult = false;
+		SightQuery.LastSeenLocation = FAISystem::InvalidLocation;
+	}
+
+	if (SightQuery.bLastResult == false)
+	{
+		SIGHT_LOG_LOCATIONVR(Listener.Listener.Get()->GetOwner(), TargetLocation, 25.f, FColor::Red, TEXT(""));
+	}
+}
+
 void UAISense_Sight_VR::RegisterEvent(const FAISightEventVR& Event)
 {
 
@@ -0,0 +1,197 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VRGripSlotIndex.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshSocket.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/SkeletalMeshSocket.h"
+#include "Animation/Skeleton.h"
+#include "UObject/UObjectGlobals.h"
+
+DECLARE_CYCLE_STAT(TEXT("GetGripSlotInRange ~ Query"), STAT_GetGripSlotInRange, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("GetGripSlotInRange ~ BuildSlotGroup"), STAT_BuildGripSlotGroup, STATGROUP_Game);
+
+FVRGripSlotIndex & FVRGripSlotIndex::Get()
+{
+	check(IsInGameThread());
+	static FVRGripSlotIndex GripSlotIndex;
+	return GripSlotIndex;
+}
+
+FVRGripSlotIndex::FVRGripSlotIndex()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FVRGripSlotIndex::OnPostGarbageCollect);
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FVRGripSlotIndex::OnObjectPropertyChanged);
+#endif
+}
+
+void FVRGripSlotIndex::Empty()
+{
+	MeshEntries.Empty();
+}
+
+void FVRGripSlotIndex::OnPostGarbageCollect()
+{
+	for (auto It = MeshEntries.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().MeshAsset.IsValid())
+			It.RemoveCurrent();
+	}
+}
+
+#if WITH_EDITOR
+void FVRGripSlotIndex::OnObjectPropertyChanged(UObject * Object, FPropertyChangedEvent & PropertyChangedEvent)
+{
+	// Sockets can be moved or renamed in the editor without changing the count, just rebuild everything
+	if (MeshEntries.Num() && Object && (Object->IsA<UStaticMesh>() || Object->IsA<UStaticMeshSocket>() ||
+		Object->IsA<USkeletalMesh>() || Object->IsA<USkeletalMeshSocket>() || Object->IsA<USkeleton>()))
+	{
+		Empty();
+	}
+}
+#endif
+
+const FVRGripSlotGroup * FVRGripSlotIndex::FindOrBuildSlotGroup(FName SlotType, USceneComponent * Component, UObject * MeshAsset, int32 SocketCount, bool bStaticSockets)
+{
+	FVRGripSlotMeshEntry * MeshEntry = MeshEntries.Find(FObjectKey(MeshAsset));
+
+	if (MeshEntry && MeshEntry->SocketCount != SocketCount)
+	{
+		MeshEntry->SlotGroups.Reset();
+		MeshEntry->SocketCount = SocketCount;
+	}
+	else if (!MeshEntry)
+	{
+		MeshEntry = &MeshEntries.Add(FObjectKey(MeshAsset));
+		MeshEntry->MeshAsset = MeshAsset;
+		MeshEntry->SocketCount = SocketCount;
+	}
+
+	if (const FVRGripSlotGroup * FoundGroup = MeshEntry->SlotGroups.Find(SlotType))
+		return FoundGroup;
+
+	SCOPE_CYCLE_COUNTER(STAT_BuildGripSlotGroup);
+
+	FVRGripSlotGroup & NewGroup = MeshEntry->SlotGroups.Add(SlotType);
+
+	TArray<FName> SocketNames = Component->GetAllSocketNames();
+	FString GripIdentifier = SlotType.ToString();
+
+	for (const FName & SocketName : SocketNames)
+	{
+		if (SocketName.ToString().Contains(GripIdentifier, ESearchCase::IgnoreCase, ESearchDir::FromStart))
+		{
+			NewGroup.SocketNames.Add(SocketName);
+
+			if (bStaticSockets)
+			{
+				NewGroup.ComponentSpaceTransforms.Add(Component->GetSocketTransform(SocketName, ERelativeTransformSpace::RTS_Component));
+			}
+		}
+	}
+
+	return &NewGroup;
+}
+
+void FVRGripSlotIndex::GetGripSlotInRange(FName SlotType, USceneComponent * Component, const FVector & WorldLocation, float MaxRange, bool & bHadSlotInRange, FTransform & SlotWorldTransform)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GetGripSlotInRange);
+
+	bHadSlotInRange = false;
+	SlotWorldTransform = FTransform::Identity;
+
+	if (!Component)
+		return;
+
+	UObject * MeshAsset = nullptr;
+	int32 SocketCount = 0;
+	bool bStaticSockets = false;
+
+	if (UStaticMeshComponent * StaticMeshComp = Cast<UStaticMeshComponent>(Component))
+	{
+		if (UStaticMesh * StaticMesh = StaticMeshComp->GetStaticMesh())
+		{
+			MeshAsset = StaticMesh;
+			SocketCount = StaticMesh->Sockets.Num();
+			bStaticSockets = true;
+		}
+	}
+	else if (USkinnedMeshComponent * SkinnedMeshComp = Cast<USkinnedMeshComponent>(Component))
+	{
+		if (USkeletalMesh * SkeletalMesh = SkinnedMeshComp->SkeletalMesh)
+		{
+			// Bone names are valid slots as well
+			MeshAsset = SkeletalMesh;
+			SocketCount = SkeletalMesh->NumSockets() + SkeletalMesh->RefSkeleton.GetNum();
+		}
+	}
+
+	FVector RelativeWorldLocation = Component->GetComponentTransform().InverseTransformPosition(WorldLocation);
+	MaxRange = FMath::Square(MaxRange);
+	float ClosestSlotDistance = -0.1f;
+
+	if (!MeshAsset)
+	{
+		// Nothing to key on, search the sockets directly
+		TArray<FName> SocketNames = Component->GetAllSocketNames();
+		FString GripIdentifier = SlotType.ToString();
+		int foundIndex = 0;
+
+		for (int i = 0; i < SocketNames.Num(); ++i)
+		{
+			if (SocketNames[i].ToString().Contains(GripIdentifier, ESearchCase::IgnoreCase, ESearchDir::FromStart))
+			{
+				float vecLen = FVector::DistSquared(RelativeWorldLocation, Component->GetSocketTransform(SocketNames[i], ERelativeTransformSpace::RTS_Component).GetLocation());
+
+				if (MaxRange >= vecLen && (ClosestSlotDistance < 0.0f || vecLen < ClosestSlotDistance))
+				{
+					ClosestSlotDistance = vecLen;
+					bHadSlotInRange = true;
+					foundIndex = i;
+				}
+			}
+		}
+
+		if (bHadSlotInRange)
+		{
+			SlotWorldTransform = Component->GetSocketTransform(SocketNames[foundIndex]);
+			SlotWorldTransform.SetScale3D(FVector(1.0f));
+		}
+
+		return;
+	}
+
+	const FVRGripSlotGroup * SlotGroup = FindOrBuildSlotGroup(SlotType, Component, MeshAsset, SocketCount, bStaticSockets);
+
+	if (!SlotGroup || !SlotGroup->SocketNames.Num())
+		return;
+
+	int foundIndex = 0;
+
+	for (int i = 0; i < SlotGroup->SocketNames.Num(); ++i)
+	{
+		FVector SlotLocation = bStaticSockets ? SlotGroup->ComponentSpaceTransforms[i].GetLocation() : Component->GetSocketTransform(SlotGroup->SocketNames[i], ERelativeTransformSpace::RTS_Component).GetLocation();
+		float vecLen = FVector::DistSquared(RelativeWorldLocation, SlotLocation);
+
+		if (MaxRange >= vecLen && (ClosestSlotDistance < 0.0f || vecLen < ClosestSlotDistance))
+		{
+			ClosestSlotDistance = vecLen;
+			bHadSlotInRange = true;
+			foundIndex = i;
+		}
+	}
+
+	if (bHadSlotInRange)
+	{
+		if (bStaticSockets)
+			SlotWorldTransform = SlotGroup->ComponentSpaceTransforms[foundIndex] * Component->GetComponentTransform();
+		else
+			SlotWorldTransform = Component->GetSocketTransform(SlotGroup->SocketNames[foundIndex]);
+
+		SlotWorldTransform.SetScale3D(FVector(1.0f));
+	}
+}
@@ -0,0 +1,538 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VRMovementReplay.h"
+#include "VRCharacter.h"
+#include "VRCharacterMovementComponent.h"
+#include "GripMotionControllerComponent.h"
+#include "ReplicatedVRCameraComponent.h"
+#include "GameFramework/GameNetworkManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/IConsoleManager.h"
+#include "EngineUtils.h"
+
+#if !UE_BUILD_SHIPPING
+namespace VRMovementReplayCounters
+{
+	bool bCounting = false;
+	uint32 FloorSweeps = 0;
+	uint32 MoveSweeps = 0;
+}
+#endif
+
+namespace
+{
+	// "VRMV"
+	const uint32 VRMovementRecordingMagic = 0x564D5256;
+	const int32 VRMovementRecordingVersion = 1;
+
+	FTransform GetRelativeTransformSafe(const USceneComponent * Component)
+	{
+		return Component ? Component->GetRelativeTransform() : FTransform::Identity;
+	}
+
+	void SetRelativeTransformSafe(USceneComponent * Component, const FTransform & Transform)
+	{
+		if (Component)
+			Component->SetRelativeTransform(Transform);
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FVRMoveActionContainer& MoveAction)
+{
+	uint8 MoveActionByte = (uint8)MoveAction.MoveAction;
+	uint8 MoveActionDataReqByte = (uint8)MoveAction.MoveActionDataReq;
+
+	Ar << MoveActionByte;
+	Ar << MoveActionDataReqByte;
+	Ar << MoveAction.MoveActionLoc;
+	Ar << MoveAction.MoveActionRot;
+
+	if (Ar.IsLoading())
+	{
+		MoveAction.MoveAction = (EVRMoveAction)MoveActionByte;
+		MoveAction.MoveActionDataReq = (EVRMoveActionDataReq)MoveActionDataReqByte;
+	}
+
+	return Ar;
+}
+
+FVRRecordedMove::FVRRecordedMove() :
+	TimeStamp(0.0f),
+	DeltaTime(0.0f),
+	Acceleration(FVector::ZeroVector),
+	ClientLocation(FVector::ZeroVector),
+	ControlRotation(FRotator::ZeroRotator),
+	CompressedFlags(0),
+	EndPackedMovementMode(0),
+	VRCapsuleLocation(FVector::ZeroVector),
+	VRCapsuleRotation(FRotator::ZeroRotator),
+	LFDiff(FVector::ZeroVector),
+	CustomVRInputVector(FVector::ZeroVector),
+	RequestedVelocity(FVector::ZeroVector),
+	HMDRelativeTransform(FTransform::Identity),
+	LeftControllerRelativeTransform(FTransform::Identity),
+	RightControllerRelativeTransform(FTransform::Identity)
+{}
+
+FArchive& operator<<(FArchive& Ar, FVRRecordedMove& Move)
+{
+	Ar << Move.TimeStamp;
+	Ar << Move.DeltaTime;
+	Ar << Move.Acceleration;
+	Ar << Move.ClientLocation;
+	Ar << Move.ControlRotation;
+	Ar << Move.CompressedFlags;
+	Ar << Move.EndPackedMovementMode;
+	Ar << Move.VRCapsuleLocation;
+	Ar << Move.VRCapsuleRotation;
+	Ar << Move.LFDiff;
+	Ar << Move.CustomVRInputVector;
+	Ar << Move.RequestedVelocity;
+	Ar << Move.MoveActions;
+	Ar << Move.HMDRelativeTransform;
+	Ar << Move.LeftControllerRelativeTransform;
+	Ar << Move.RightControllerRelativeTransform;
+	return Ar;
+}
+
+FVRMovementRecording::FVRMovementRecording() :
+	StartLocation(FVector::ZeroVector),
+	StartRotation(FRotator::ZeroRotator),
+	StartVelocity(FVector::ZeroVector),
+	CapsuleHalfHeight(0.0f),
+	CapsuleRadius(0.0f)
+{}
+
+FArchive& operator<<(FArchive& Ar, FVRMovementRecording& Recording)
+{
+	Ar << Recording.StartLocation;
+	Ar << Recording.StartRotation;
+	Ar << Recording.StartVelocity;
+	Ar << Recording.CapsuleHalfHeight;
+	Ar << Recording.CapsuleRadius;
+	Ar << Recording.Moves;
+	return Ar;
+}
+
+void FVRMovementRecording::Begin(AVRCharacter * Character)
+{
+	Moves.Reset();
+
+	if (!Character)
+		return;
+
+	StartLocation = Character->GetActorLocation();
+	StartRotation = Character->GetActorRotation();
+	StartVelocity = Character->GetVelocity();
+
+	if (Character->VRRootReference)
+	{
+		CapsuleHalfHeight = Character->VRRootReference->GetUnscaledCapsuleHalfHeight();
+		CapsuleRadius = Character->VRRootReference->GetUnscaledCapsuleRadius();
+	}
+}
+
+void FVRMovementRecording::RecordMove(const FSavedMove_VRCharacter & Move, AVRCharacter * Character)
+{
+	FVRRecordedMove & NewMove = Moves[Moves.AddDefaulted()];
+
+	NewMove.TimeStamp = Move.TimeStamp;
+	NewMove.DeltaTime = Move.DeltaTime;
+	NewMove.Acceleration = Move.Acceleration;
+	NewMove.ClientLocation = Move.SavedLocation;
+	NewMove.ControlRotation = Move.SavedControlRotation;
+	NewMove.CompressedFlags = Move.GetCompressedFlags();
+	NewMove.EndPackedMovementMode = Move.EndPackedMovementMode;
+
+	NewMove.VRCapsuleLocation = Move.VRCapsuleLocation;
+	NewMove.VRCapsuleRotation = Move.VRCapsuleRotation;
+	NewMove.LFDiff = Move.LFDiff;
+	NewMove.CustomVRInputVector = Move.ConditionalValues.CustomVRInputVector;
+	NewMove.RequestedVelocity = Move.ConditionalValues.RequestedVelocity;
+	NewMove.MoveActions = Move.ConditionalValues.MoveActionArray.MoveActions;
+
+	if (Character)
+	{
+		NewMove.HMDRelativeTransform = GetRelativeTransformSafe(Character->VRReplicatedCamera);
+		NewMove.LeftControllerRelativeTransform = GetRelativeTransformSafe(Character->LeftMotionController);
+		NewMove.RightControllerRelativeTransform = GetRelativeTransformSafe(Character->RightMotionController);
+	}
+}
+
+FString FVRMovementRecording::GetRecordingPath(const FString & FileName)
+{
+	if (FPaths::IsRelative(FileName))
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("VRMovement"), FileName);
+
+	return FileName;
+}
+
+bool FVRMovementRecording::SaveToFile(const FString & FileName) const
+{
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data, true);
+
+	uint32 Magic = VRMovementRecordingMagic;
+	int32 Version = VRMovementRecordingVersion;
+	Writer << Magic;
+	Writer << Version;
+	Writer << const_cast<FVRMovementRecording&>(*this);
+
+	return FFileHelper::SaveArrayToFile(Data, *GetRecordingPath(FileName));
+}
+
+bool FVRMovementRecording::LoadFromFile(const FString & FileName)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *GetRecordingPath(FileName)))
+		return false;
+
+	FMemoryReader Reader(Data, true);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	Reader << Magic;
+	Reader << Version;
+
+	if (Magic != VRMovementRecordingMagic || Version != VRMovementRecordingVersion)
+		return false;
+
+	Reader << *this;
+	return !Reader.IsError();
+}
+
+FString FVRMovementReplayReport::ToString() const
+{
+	return FString::Printf(TEXT("Moves: %d Total: %.3fms Avg: %.4fms Max: %.4fms FloorSweeps: %u MoveSweeps: %u Corrections: %d ServerMoves: %d"),
+		NumMoves, TotalMoveMs, NumMoves > 0 ? TotalMoveMs / NumMoves : 0.0, MaxMoveMs, FloorSweeps, MoveSweeps, Corrections, ServerMoves);
+}
+
+FVRMovementReplayReport FVRMovementReplay::Replay(AVRCharacter * Character, const FVRMovementRecording & Recording, bool bServerPath, FVRMovementRecording * OutSentMoves, bool bCombineMoves)
+{
+	FVRMovementReplayReport Report;
+
+	UVRCharacterMovementComponent * CharMove = Character ? Cast<UVRCharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+
+	if (!CharMove || !Recording.Moves.Num())
+		return Report;
+
+	// The replay character has no controller, let it move anyway
+	CharMove->bRunPhysicsWithNoController = true;
+
+	if (Character->VRRootReference && Recording.CapsuleHalfHeight > 0.0f)
+	{
+		Character->VRRootReference->SetCapsuleSize(Recording.CapsuleRadius, Recording.CapsuleHalfHeight, false);
+	}
+
+	Character->TeleportTo(Recording.StartLocation, Recording.StartRotation, false, true);
+	CharMove->Velocity = Recording.StartVelocity;
+	CharMove->SetMovementMode(MOVE_Walking);
+	CharMove->FindFloor(CharMove->UpdatedComponent->GetComponentLocation(), CharMove->CurrentFloor, false);
+
+	FNetworkPredictionData_Server_Character * ServerData = bServerPath ? CharMove->GetPredictionData_Server_Character() : nullptr;
+	if (ServerData)
+	{
+		const FVRRecordedMove & FirstMove = Recording.Moves[0];
+		ServerData->CurrentClientTimeStamp = FirstMove.TimeStamp - FirstMove.DeltaTime;
+		ServerData->LastUpdateTime = Character->GetWorld()->GetTimeSeconds();
+		ServerData->PendingAdjustment = FClientAdjustment();
+	}
+
+	const AGameNetworkManager * GameNetworkManager = GetDefault<AGameNetworkManager>();
+
+	if (OutSentMoves)
+	{
+		*OutSentMoves = Recording;
+		OutSentMoves->Moves.Reset();
+	}
+
+	// Client path only, the last move that could still be combined with the next one
+	FSavedMovePtr PendingMove;
+	const bool bCombine = bCombineMoves && !ServerData;
+	const float MaxCombinedDeltaTime = bCombine ? CharMove->GetPredictionData_Client_Character()->MaxMoveDeltaTime * Character->GetActorTimeDilation() : 0.0f;
+
+#if !UE_BUILD_SHIPPING
+	check(IsInGameThread());
+	VRMovementReplayCounters::FloorSweeps = 0;
+	VRMovementReplayCounters::MoveSweeps = 0;
+	TGuardValue<bool> CountingGuard(VRMovementReplayCounters::bCounting, true);
+#endif
+
+	for (const FVRRecordedMove & Move : Recording.Moves)
+	{
+		SetRelativeTransformSafe(Character->VRReplicatedCamera, Move.HMDRelativeTransform);
+		SetRelativeTransformSafe(Character->LeftMotionController, Move.LeftControllerRelativeTransform);
+		SetRelativeTransformSafe(Character->RightMotionController, Move.RightControllerRelativeTransform);
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		if (ServerData)
+		{
+			// Client timestamps reset periodically, keep the server in step with them
+			if (Move.TimeStamp <= ServerData->CurrentClientTimeStamp)
+				ServerData->CurrentClientTimeStamp = Move.TimeStamp - Move.DeltaTime;
+
+			FVRConditionalMoveRep ConditionalReps;
+			ConditionalReps.CustomVRInputVector = Move.CustomVRInputVector;
+			ConditionalReps.RequestedVelocity = Move.RequestedVelocity;
+			ConditionalReps.MoveActionArray.MoveActions = Move.MoveActions;
+
+			FVRConditionalMoveRep2 MoveReps;
+			MoveReps.ClientYaw = FRotator::CompressAxisToShort(Move.ControlRotation.Yaw);
+			MoveReps.ClientPitch = FRotator::CompressAxisToShort(Move.ControlRotation.Pitch);
+			MoveReps.ClientRoll = FRotator::CompressAxisToByte(Move.ControlRotation.Roll);
+
+			CharMove->ServerMoveVR_Implementation(
+				Move.TimeStamp,
+				Move.Acceleration,
+				Move.ClientLocation,
+				Move.VRCapsuleLocation,
+				ConditionalReps,
+				Move.LFDiff,
+				FRotator::CompressAxisToShort(Move.VRCapsuleRotation.Yaw),
+				Move.CompressedFlags,
+				MoveReps,
+				Move.EndPackedMovementMode
+			);
+
+			if (ServerData->PendingAdjustment.TimeStamp == Move.TimeStamp && !ServerData->PendingAdjustment.bAckGoodMove)
+			{
+				++Report.Corrections;
+			}
+
+			ServerData->PendingAdjustment = FClientAdjustment();
+			ServerData->bForceClientUpdate = false;
+			++Report.ServerMoves;
+		}
+		else
+		{
+			FSavedMovePtr SavedMovePtr = MakeShareable(new FSavedMove_VRCharacter());
+			FSavedMove_VRCharacter & SavedMove = *(FSavedMove_VRCharacter *)SavedMovePtr.Get();
+			SavedMove.TimeStamp = Move.TimeStamp;
+			SavedMove.DeltaTime = Move.DeltaTime;
+			SavedMove.Acceleration = Move.Acceleration;
+			SavedMove.SavedControlRotation = Move.ControlRotation;
+			SavedMove.VRCapsuleLocation = Move.VRCapsuleLocation;
+			SavedMove.VRCapsuleRotation = Move.VRCapsuleRotation;
+			SavedMove.LFDiff = Move.LFDiff;
+			SavedMove.ConditionalValues.CustomVRInputVector = Move.CustomVRInputVector;
+			SavedMove.ConditionalValues.RequestedVelocity = Move.RequestedVelocity;
+			SavedMove.ConditionalValues.MoveActionArray.MoveActions = Move.MoveActions;
+			SavedMove.VRReplicatedMovementMode = (EVRConjoinedMovementModes)((Move.CompressedFlags >> 2) & 0x0F);
+
+			SavedMove.PrepMoveFor(Character);
+
+			uint8 CompressedFlags = Move.CompressedFlags;
+			bool bCombined = false;
+
+			if (bCombine)
+			{
+				// Same steps as ReplicateMoveToServer, the VR values are read back from the movement component that PrepMoveFor filled in
+				SavedMove.SetInitialPosition(Character);
+
+				if (PendingMove.IsValid() && PendingMove->TimeStamp < Move.TimeStamp && PendingMove->CanCombineWith(SavedMovePtr, Character, MaxCombinedDeltaTime))
+				{
+					const FVector OldStartLocation = PendingMove->GetRevertedLocation();
+
+					FVector OverlapLocation = OldStartLocation;
+					if (CharMove->VRRootCapsule)
+						OverlapLocation += CharMove->VRRootCapsule->OffsetComponentToWorld.GetLocation() - CharMove->VRRootCapsule->GetComponentLocation();
+
+					if (!CharMove->OverlapTest(OverlapLocation, PendingMove->StartRotation.Quaternion(), CharMove->UpdatedComponent->GetCollisionObjectType(), CharMove->GetPawnCapsuleCollisionShape(SHRINK_None), Character))
+					{
+						SavedMove.CombineWith(PendingMove.Get(), Character, nullptr, OldStartLocation);
+						SavedMove.SetInitialPosition(Character);
+
+						// The combined move carries the pending moves movement mode change
+						CompressedFlags = (CompressedFlags & ~(0x0F << 2)) | ((uint8)SavedMove.VRReplicatedMovementMode << 2);
+						bCombined = true;
+					}
+				}
+			}
+
+			// The authority clears the move actions in PerformMovement, keep the ones that would be sent
+			const FVRMoveActionArray SentMoveActions = CharMove->MoveActionArray;
+
+			CharMove->MoveAutonomous(Move.TimeStamp, SavedMove.DeltaTime, CompressedFlags, Move.Acceleration);
+
+			if (bCombine)
+			{
+				SavedMove.PostUpdate(Character, FSavedMove_Character::PostUpdate_Record);
+				SavedMove.ConditionalValues.MoveActionArray = SentMoveActions;
+				PendingMove = SavedMovePtr;
+			}
+
+			if (!bCombined)
+			{
+				++Report.ServerMoves;
+			}
+
+			if (GameNetworkManager->ExceedsAllowablePositionError(CharMove->UpdatedComponent->GetComponentLocation() - Move.ClientLocation))
+			{
+				++Report.Corrections;
+			}
+
+			if (OutSentMoves)
+			{
+				// A combined move replaces the pending one that was already sent
+				if (bCombined)
+					OutSentMoves->Moves.Pop(false);
+
+				FVRRecordedMove & SentMove = OutSentMoves->Moves[OutSentMoves->Moves.Add(Move)];
+				SentMove.DeltaTime = SavedMove.DeltaTime;
+				SentMove.CompressedFlags = CompressedFlags;
+				SentMove.LFDiff = SavedMove.LFDiff;
+				SentMove.CustomVRInputVector = SavedMove.ConditionalValues.CustomVRInputVector;
+				SentMove.MoveActions = SentMoveActions.MoveActions;
+				SentMove.ClientLocation = CharMove->UpdatedComponent->GetComponentLocation();
+				SentMove.EndPackedMovementMode = CharMove->PackNetworkMovementMode();
+			}
+		}
+
+		const double MoveMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		Report.TotalMoveMs += MoveMs;
+		Report.MaxMoveMs = FMath::Max(Report.MaxMoveMs, MoveMs);
+		++Report.NumMoves;
+	}
+
+#if !UE_BUILD_SHIPPING
+	Report.FloorSweeps = VRMovementReplayCounters::FloorSweeps;
+	Report.MoveSweeps = VRMovementReplayCounters::MoveSweeps;
+#endif
+
+	return Report;
+}
+
+namespace VRMovementReplayCommands
+{
+	AVRCharacter * GetLocalVRCharacter(UWorld * World)
+	{
+		if (!World)
+			return nullptr;
+
+		if (APlayerController * PC = World->GetFirstPlayerController())
+		{
+			if (AVRCharacter * VRChar = Cast<AVRCharacter>(PC->GetPawn()))
+				return VRChar;
+		}
+
+		for (TActorIterator<AVRCharacter> It(World); It; ++It)
+		{
+			return *It;
+		}
+
+		return nullptr;
+	}
+
+	void StartRecording(const TArray<FString> & Args, UWorld * World)
+	{
+		AVRCharacter * VRChar = GetLocalVRCharacter(World);
+		UVRCharacterMovementComponent * CharMove = VRChar ? Cast<UVRCharacterMovementComponent>(VRChar->GetCharacterMovement()) : nullptr;
+
+		if (!CharMove)
+		{
+			UE_LOG(LogVRCharacterMovement, Warning, TEXT("vr.MovementRecordStart: No VRCharacter found"));
+			return;
+		}
+
+		// Moves are captured as they are sent to the server, standalone games never send any
+		if (VRChar->Role != ROLE_AutonomousProxy)
+		{
+			UE_LOG(LogVRCharacterMovement, Warning, TEXT("vr.MovementRecordStart: Moves are only recorded on a networked client"));
+		}
+
+		CharMove->ActiveMovementRecording = MakeShareable(new FVRMovementRecording());
+		CharMove->ActiveMovementRecording->Begin(VRChar);
+	}
+
+	void StopRecording(const TArray<FString> & Args, UWorld * World)
+	{
+		AVRCharacter * VRChar = GetLocalVRCharacter(World);
+		UVRCharacterMovementComponent * CharMove = VRChar ? Cast<UVRCharacterMovementComponent>(VRChar->GetCharacterMovement()) : nullptr;
+
+		if (!CharMove || !CharMove->ActiveMovementRecording.IsValid())
+		{
+			UE_LOG(LogVRCharacterMovement, Warning, TEXT("vr.MovementRecordStop: No active recording"));
+			return;
+		}
+
+		FString FileName = Args.Num() > 0 ? Args[0] : TEXT("VRMovement.vrmove");
+
+		if (CharMove->ActiveMovementRecording->SaveToFile(FileName))
+		{
+			UE_LOG(LogVRCharacterMovement, Log, TEXT("vr.MovementRecordStop: Saved %d moves to %s"), CharMove->ActiveMovementRecording->Moves.Num(), *FVRMovementRecording::GetRecordingPath(FileName));
+		}
+		else
+		{
+			UE_LOG(LogVRCharacterMovement, Warning, TEXT("vr.MovementRecordStop: Failed to save %s"), *FVRMovementRecording::GetRecordingPath(FileName));
+		}
+
+		CharMove->ActiveMovementRecording.Reset();
+	}
+
+	void ReplayRecording(const TArray<FString> & Args, UWorld * World)
+	{
+		if (!World || Args.Num() < 1)
+		{
+			UE_LOG(LogVRCharacterMovement, Warning, TEXT("Usage: vr.MovementReplay <File> [server|client|combine] [Class]"));
+			return;
+		}
+
+		FVRMovementRecording Recording;
+		if (!Recording.LoadFromFile(Args[0]))
+		{
+			UE_LOG(LogVRCharacterMovement, Warning, TEXT("vr.MovementReplay: Failed to load %s"), *FVRMovementRecording::GetRecordingPath(Args[0]));
+			return;
+		}
+
+		const bool bCombineMoves = Args.Num() > 1 && Args[1].Equals(TEXT("combine"), ESearchCase::IgnoreCase);
+		const bool bServerPath = !bCombineMoves && (Args.Num() < 2 || !Args[1].Equals(TEXT("client"), ESearchCase::IgnoreCase));
+
+		// Replay on a fresh copy so that the running character is left alone and every run starts from the same state
+		UClass * CharacterClass = AVRCharacter::StaticClass();
+		if (Args.Num() > 2)
+		{
+			if (UClass * FoundClass = LoadClass<AVRCharacter>(nullptr, *Args[2]))
+				CharacterClass = FoundClass;
+		}
+		else if (AVRCharacter * ExistingChar = GetLocalVRCharacter(World))
+		{
+			CharacterClass = ExistingChar->GetClass();
+		}
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnParams.ObjectFlags |= RF_Transient;
+
+		AVRCharacter * ReplayChar = World->SpawnActor<AVRCharacter>(CharacterClass, Recording.StartLocation, Recording.StartRotation, SpawnParams);
+		if (!ReplayChar)
+		{
+			UE_LOG(LogVRCharacterMovement, Warning, TEXT("vr.MovementReplay: Failed to spawn %s"), *GetNameSafe(CharacterClass));
+			return;
+		}
+
+		FVRMovementReplayReport Report = FVRMovementReplay::Replay(ReplayChar, Recording, bServerPath, nullptr, bCombineMoves);
+		UE_LOG(LogVRCharacterMovement, Log, TEXT("vr.MovementReplay (%s) %s: %s"), bServerPath ? TEXT("server") : bCombineMoves ? TEXT("combine") : TEXT("client"), *Args[0], *Report.ToString());
+
+		ReplayChar->Destroy();
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs MovementRecordStartCommand(
+		TEXT("vr.MovementRecordStart"),
+		TEXT("Starts recording the moves the local VRCharacter sends to the server"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&StartRecording));
+
+	FAutoConsoleCommandWithWorldAndArgs MovementRecordStopCommand(
+		TEXT("vr.MovementRecordStop"),
+		TEXT("Stops recording and saves the moves. Arguments: [File], relative files are placed in Saved/VRMovement"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&StopRecording));
+
+	FAutoConsoleCommandWithWorldAndArgs MovementReplayCommand(
+		TEXT("vr.MovementReplay"),
+		TEXT("Replays a movement recording on a spawned VRCharacter and logs timing, sweep and correction counts. Arguments: <File> [server|client|combine] [CharacterClassPath], combine is the client path with moves combined"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&ReplayRecording));
+}
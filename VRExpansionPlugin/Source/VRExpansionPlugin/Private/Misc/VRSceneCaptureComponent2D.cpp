@@ -0,0 +1,158 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VRSceneCaptureComponent2D.h"
+#include "Camera/CameraComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/WorldSettings.h"
+#include "IXRTrackingSystem.h"
+#include "StereoRendering.h"
+
+FVRSceneCaptureHMDSnapshot::FVRSceneCaptureHMDSnapshot() :
+	Frame(0),
+	bValid(false),
+	Orientation(FQuat::Identity)
+{
+	EyePositions[0] = EyePositions[1] = FVector::ZeroVector;
+	EyeProjections[0] = EyeProjections[1] = FMatrix::Identity;
+}
+
+const FVRSceneCaptureHMDSnapshot & FVRSceneCaptureHMDSnapshot::Get(UWorld * World)
+{
+	check(IsInGameThread());
+	static FVRSceneCaptureHMDSnapshot Snapshot;
+
+	if (Snapshot.Frame != GFrameCounter)
+	{
+		Snapshot.Frame = GFrameCounter;
+		Snapshot.Update(World);
+	}
+
+	return Snapshot;
+}
+
+void FVRSceneCaptureHMDSnapshot::Update(UWorld * World)
+{
+	FVector Position = FVector::ZeroVector;
+
+	bValid = GEngine->XRSystem.IsValid() && GEngine->StereoRenderingDevice.IsValid() && GEngine->IsStereoscopic3D() &&
+		GEngine->XRSystem->IsHeadTrackingAllowed() && GEngine->XRSystem->GetCurrentPose(IXRTrackingSystem::HMDDeviceId, Orientation, Position);
+
+	if (!bValid)
+		return;
+
+	const float WorldToMeters = World ? World->GetWorldSettings()->WorldToMeters : 100.0f;
+
+	for (int32 Eye = 0; Eye < 2; ++Eye)
+	{
+		const EStereoscopicPass StereoPass = Eye == 0 ? EStereoscopicPass::eSSP_LEFT_EYE : EStereoscopicPass::eSSP_RIGHT_EYE;
+
+		FRotator EyeRotation = Orientation.Rotator();
+		EyePositions[Eye] = Position;
+		GEngine->StereoRenderingDevice->CalculateStereoViewOffset(StereoPass, EyeRotation, WorldToMeters, EyePositions[Eye]);
+		EyeProjections[Eye] = GEngine->StereoRenderingDevice->GetStereoProjectionMatrix(StereoPass);
+	}
+}
+
+UVRSceneCaptureComponent2D::UVRSceneCaptureComponent2D(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	bTrackLocalHMDOrCamera = false;
+	bIsLeftEye = false;
+	CaptureEveryNthFrame = 1;
+	bAlternateEyeFrames = false;
+}
+
+bool UVRSceneCaptureComponent2D::ShouldCaptureThisFrame() const
+{
+	uint64 Frame = GFrameCounter;
+
+	if (bAlternateEyeFrames && bTrackLocalHMDOrCamera)
+	{
+		if ((Frame % 2) != (bIsLeftEye ? 0 : 1))
+			return false;
+
+		// Each eye only gets every other frame, count N in its own frames
+		Frame /= 2;
+	}
+
+	return CaptureEveryNthFrame <= 1 || (Frame % CaptureEveryNthFrame) == 0;
+}
+
+UCameraComponent * UVRSceneCaptureComponent2D::GetLocalPlayerCamera()
+{
+	UWorld * World = GetWorld();
+	APlayerController* Player = World ? World->GetFirstPlayerController() : nullptr;
+	APawn * Pawn = (Player != nullptr && Player->IsLocalController()) ? Player->GetPawn() : nullptr;
+
+	if (!Pawn)
+		return nullptr;
+
+	if (CachedCameraPawn.Get() != Pawn || !CachedCamera.IsValid() || !CachedCamera->bIsActive)
+	{
+		CachedCameraPawn = Pawn;
+		CachedCamera.Reset();
+
+		for (UActorComponent* CamComponent : Pawn->GetComponentsByClass(UCameraComponent::StaticClass()))
+		{
+			UCameraComponent * CameraComponent = Cast<UCameraComponent>(CamComponent);
+
+			if (CameraComponent != nullptr && CameraComponent->bIsActive)
+			{
+				CachedCamera = CameraComponent;
+				break;
+			}
+		}
+	}
+
+	return CachedCamera.Get();
+}
+
+void UVRSceneCaptureComponent2D::UpdateSceneCaptureContents(FSceneInterface* Scene)
+{
+	if (!ShouldCaptureThisFrame())
+		return;
+
+	if (bTrackLocalHMDOrCamera)
+	{
+		FQuat Orientation = FQuat::Identity;
+		FVector Position = FVector::ZeroVector;
+
+		const FVRSceneCaptureHMDSnapshot & HMDSnapshot = FVRSceneCaptureHMDSnapshot::Get(GetWorld());
+
+		if (HMDSnapshot.bValid)
+		{
+			const int32 Eye = bIsLeftEye ? 0 : 1;
+			Orientation = HMDSnapshot.Orientation;
+			Position = HMDSnapshot.EyePositions[Eye];
+
+			bUseCustomProjectionMatrix = true;
+			CustomProjectionMatrix = HMDSnapshot.EyeProjections[Eye];
+			CaptureStereoPass = bIsLeftEye ? EStereoscopicPass::eSSP_LEFT_EYE : EStereoscopicPass::eSSP_RIGHT_EYE;
+		}
+		else
+		{
+			bUseCustomProjectionMatrix = false;
+			CaptureStereoPass = EStereoscopicPass::eSSP_FULL;
+
+			if (UCameraComponent * CameraComponent = GetLocalPlayerCamera())
+			{
+				const FTransform CameraTransform = CameraComponent->GetRelativeTransform();
+				Orientation = CameraTransform.GetRotation();
+				Position = CameraTransform.GetTranslation();
+			}
+		}
+
+		SetRelativeLocationAndRotation(Position, Orientation);
+	}
+	else
+	{
+		bUseCustomProjectionMatrix = false;
+		CaptureStereoPass = EStereoscopicPass::eSSP_FULL;
+	}
+
+	// This pulls from the GetComponentToWorld so setting just prior to it is picked up by the capture
+	Super::UpdateSceneCaptureContents(Scene);
+}
@@ -0,0 +1,289 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VRServerMoveQueue.h"
+#include "VRCharacterMovementComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/NetConnection.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+
+DECLARE_CYCLE_STAT(TEXT("Char ServerMoveQueue"), STAT_CharServerMoveQueue, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Char ServerMoves Queued"), STAT_CharServerMovesQueued, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Char ServerMoves Forced"), STAT_CharServerMovesForced, STATGROUP_Character);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Char ServerMoveQueue Depth"), STAT_CharServerMoveQueueDepth, STATGROUP_Character);
+
+namespace VRServerMoveQueueCVars
+{
+	static float ServerMoveBudgetMs = 0.0f;
+	FAutoConsoleVariableRef CVarServerMoveBudgetMs(
+		TEXT("vre.ServerMoveBudgetMs"),
+		ServerMoveBudgetMs,
+		TEXT("Milliseconds per frame that the server spends simulating incoming VR client moves before queuing the rest for later frames.\n")
+		TEXT("0: Run every move as it arrives"),
+		ECVF_Default);
+
+	static float ServerMoveMaxQueueAge = 0.1f;
+	FAutoConsoleVariableRef CVarServerMoveMaxQueueAge(
+		TEXT("vre.ServerMoveMaxQueueAge"),
+		ServerMoveMaxQueueAge,
+		TEXT("Seconds that a move can wait in the queue before it is run regardless of the budget."),
+		ECVF_Default);
+}
+
+FVRServerMoveQueue & FVRServerMoveQueue::Get()
+{
+	check(IsInGameThread());
+	static FVRServerMoveQueue ServerMoveQueue;
+	return ServerMoveQueue;
+}
+
+FVRServerMoveQueue::FVRServerMoveQueue() :
+	RoundRobinIndex(0),
+	BudgetFrame(0),
+	BudgetSpent(0.0)
+{
+}
+
+bool FVRServerMoveQueue::IsEnabled()
+{
+	return VRServerMoveQueueCVars::ServerMoveBudgetMs > 0.0f;
+}
+
+bool FVRServerMoveQueue::ShouldQueueMoves(const UVRCharacterMovementComponent * MoveComp)
+{
+	if (!MoveComp || MoveComp->ServerMoveQueueState.bExecuting)
+		return false;
+
+	// Local and AI characters never receive moves, spawned test characters (the movement replay) run them directly
+	const ACharacter * CharacterOwner = MoveComp->GetCharacterOwner();
+	const APlayerController * PC = CharacterOwner ? Cast<APlayerController>(CharacterOwner->GetController()) : nullptr;
+	return PC && !PC->IsLocalController() && PC->GetNetConnection() != nullptr;
+}
+
+void FVRServerMoveQueue::BeginFrameBudget()
+{
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		BudgetSpent = 0.0;
+	}
+}
+
+bool FVRServerMoveQueue::HasBudgetLeft() const
+{
+	return BudgetSpent * 1000.0 < VRServerMoveQueueCVars::ServerMoveBudgetMs;
+}
+
+void FVRServerMoveQueue::SubmitMove(UVRCharacterMovementComponent * MoveComp, TFunction<void()> && Move)
+{
+	check(MoveComp);
+	BeginFrameBudget();
+
+	FVRServerMoveQueueState & State = MoveComp->ServerMoveQueueState;
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	// Keep this connection moving even if nothing is ticking the queue
+	RunExpiredMoves(MoveComp, CurrentTime);
+
+	// Nothing to keep in order with and we can afford it, no reason to add latency
+	if (!State.Moves.Num() && HasBudgetLeft())
+	{
+		ExecuteMove(MoveComp, Move, CurrentTime, false);
+		return;
+	}
+
+	FVRQueuedServerMove & QueuedMove = State.Moves[State.Moves.AddDefaulted()];
+	QueuedMove.Execute = MoveTemp(Move);
+	QueuedMove.QueuedTime = CurrentTime;
+	State.MaxDepth = FMath::Max(State.MaxDepth, State.Moves.Num());
+
+	QueuedComponents.AddUnique(MoveComp);
+	INC_DWORD_STAT(STAT_CharServerMovesQueued);
+}
+
+void FVRServerMoveQueue::ExecuteMove(UVRCharacterMovementComponent * MoveComp, TFunction<void()> & Move, double QueuedTime, bool bForced)
+{
+	FVRServerMoveQueueState & State = MoveComp->ServerMoveQueueState;
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double Latency = StartTime - QueuedTime;
+
+	State.bExecuting = true;
+	Move();
+	State.bExecuting = false;
+
+	BudgetSpent += FPlatformTime::Seconds() - StartTime;
+
+	State.NumProcessed++;
+	State.TotalLatency += Latency;
+	State.MaxLatency = FMath::Max(State.MaxLatency, Latency);
+
+	if (bForced)
+	{
+		State.NumForced++;
+		INC_DWORD_STAT(STAT_CharServerMovesForced);
+	}
+}
+
+void FVRServerMoveQueue::ExecuteFrontMove(UVRCharacterMovementComponent * MoveComp, bool bForced)
+{
+	FVRServerMoveQueueState & State = MoveComp->ServerMoveQueueState;
+
+	// Pull it out first, the move can submit more moves
+	FVRQueuedServerMove QueuedMove = MoveTemp(State.Moves[0]);
+	State.Moves.RemoveAt(0, 1, false);
+
+	ExecuteMove(MoveComp, QueuedMove.Execute, QueuedMove.QueuedTime, bForced);
+}
+
+void FVRServerMoveQueue::RunExpiredMoves(UVRCharacterMovementComponent * MoveComp, double CurrentTime)
+{
+	FVRServerMoveQueueState & State = MoveComp->ServerMoveQueueState;
+
+	while (State.Moves.Num() && (CurrentTime - State.Moves[0].QueuedTime) >= VRServerMoveQueueCVars::ServerMoveMaxQueueAge)
+	{
+		ExecuteFrontMove(MoveComp, true);
+	}
+}
+
+void FVRServerMoveQueue::DrainMoves(UVRCharacterMovementComponent * MoveComp)
+{
+	FVRServerMoveQueueState & State = MoveComp->ServerMoveQueueState;
+
+	while (State.Moves.Num())
+	{
+		ExecuteFrontMove(MoveComp, true);
+	}
+}
+
+void FVRServerMoveQueue::ProcessWorld(UWorld * World)
+{
+	if (!World || !QueuedComponents.Num())
+		return;
+
+	uint64 & ProcessedFrame = LastProcessedFrame.FindOrAdd(FObjectKey(World));
+	if (ProcessedFrame == GFrameCounter)
+		return;
+
+	ProcessedFrame = GFrameCounter;
+
+	SCOPE_CYCLE_COUNTER(STAT_CharServerMoveQueue);
+	BeginFrameBudget();
+
+	// Anything that has waited too long runs no matter what
+	const double CurrentTime = FPlatformTime::Seconds();
+	for (TWeakObjectPtr<UVRCharacterMovementComponent> & WeakMoveComp : QueuedComponents)
+	{
+		UVRCharacterMovementComponent * MoveComp = WeakMoveComp.Get();
+		if (MoveComp && MoveComp->GetWorld() == World)
+		{
+			RunExpiredMoves(MoveComp, CurrentTime);
+		}
+	}
+
+	// Budget was turned off with moves still waiting, nothing holds them back anymore
+	if (!IsEnabled())
+	{
+		for (TWeakObjectPtr<UVRCharacterMovementComponent> & WeakMoveComp : QueuedComponents)
+		{
+			UVRCharacterMovementComponent * MoveComp = WeakMoveComp.Get();
+			if (MoveComp && MoveComp->GetWorld() == World)
+			{
+				DrainMoves(MoveComp);
+			}
+		}
+	}
+
+	// One move per character per pass so that a single busy connection can't use up the budget, starting after whoever was served last
+	int32 LastServedIndex = INDEX_NONE;
+	bool bRanMove = IsEnabled();
+	while (bRanMove && HasBudgetLeft())
+	{
+		bRanMove = false;
+
+		for (int32 i = 0; i < QueuedComponents.Num() && HasBudgetLeft(); ++i)
+		{
+			const int32 Index = (RoundRobinIndex + i) % QueuedComponents.Num();
+			UVRCharacterMovementComponent * MoveComp = QueuedComponents[Index].Get();
+
+			if (!MoveComp || MoveComp->GetWorld() != World || !MoveComp->ServerMoveQueueState.Moves.Num())
+				continue;
+
+			ExecuteFrontMove(MoveComp, false);
+			LastServedIndex = Index;
+			bRanMove = true;
+		}
+	}
+
+	if (LastServedIndex != INDEX_NONE)
+	{
+		RoundRobinIndex = LastServedIndex + 1;
+	}
+
+	QueuedComponents.RemoveAll([](const TWeakObjectPtr<UVRCharacterMovementComponent> & WeakMoveComp)
+	{
+		return !WeakMoveComp.IsValid() || !WeakMoveComp->ServerMoveQueueState.Moves.Num();
+	});
+
+	RoundRobinIndex = QueuedComponents.Num() ? RoundRobinIndex % QueuedComponents.Num() : 0;
+
+#if STATS
+	int32 TotalDepth = 0;
+	for (const TWeakObjectPtr<UVRCharacterMovementComponent> & WeakMoveComp : QueuedComponents)
+	{
+		TotalDepth += WeakMoveComp->ServerMoveQueueState.Moves.Num();
+	}
+	SET_DWORD_STAT(STAT_CharServerMoveQueueDepth, TotalDepth);
+#endif
+}
+
+void FVRServerMoveQueue::DumpStats(UWorld * World, bool bReset)
+{
+	UE_LOG(LogVRCharacterMovement, Log, TEXT("Server move queue: budget %.2fms, max age %.3fs"), VRServerMoveQueueCVars::ServerMoveBudgetMs, VRServerMoveQueueCVars::ServerMoveMaxQueueAge);
+
+	for (TObjectIterator<UVRCharacterMovementComponent> It; It; ++It)
+	{
+		UVRCharacterMovementComponent * MoveComp = *It;
+		if (MoveComp->GetWorld() != World || MoveComp->IsTemplate())
+			continue;
+
+		const ACharacter * CharacterOwner = MoveComp->GetCharacterOwner();
+		const APlayerController * PC = CharacterOwner ? Cast<APlayerController>(CharacterOwner->GetController()) : nullptr;
+		UNetConnection * NetConnection = PC ? PC->GetNetConnection() : nullptr;
+
+		if (!NetConnection || PC->IsLocalController())
+			continue;
+
+		FVRServerMoveQueueState & State = MoveComp->ServerMoveQueueState;
+		UE_LOG(LogVRCharacterMovement, Log, TEXT("  %s (%s): depth %d, max depth %d, processed %d, forced %d, avg latency %.2fms, max latency %.2fms"),
+			*GetNameSafe(CharacterOwner),
+			*NetConnection->LowLevelGetRemoteAddress(true),
+			State.Moves.Num(),
+			State.MaxDepth,
+			State.NumProcessed,
+			State.NumForced,
+			State.NumProcessed ? (State.TotalLatency / State.NumProcessed) * 1000.0 : 0.0,
+			State.MaxLatency * 1000.0);
+
+		if (bReset)
+		{
+			State.ResetStats();
+		}
+	}
+}
+
+namespace
+{
+	void DumpServerMoveQueueStats(const TArray<FString> & Args, UWorld * World)
+	{
+		const bool bReset = Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase);
+		FVRServerMoveQueue::Get().DumpStats(World, bReset);
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs ServerMoveQueueStatsCommand(
+		TEXT("vre.ServerMoveQueueStats"),
+		TEXT("Logs the server move queue depth and latency for each connection. Arguments: [reset]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DumpServerMoveQueueStats));
+}
@@ -0,0 +1,132 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VRAIPerceptionOverrides.h"
+#include "AIController.h"
+#include "Perception/AIPerceptionComponent.h"
+#include "Perception/AIPerceptionSystem.h"
+#include "GameFramework/DefaultPawn.h"
+#include "Engine/Engine.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRAISightQueryBenchmark, "VRExpansionPlugin.AISightQuerySelection", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+namespace VRAISightQueryBenchmark
+{
+	const int32 NumUpdates = 60;
+
+	// Game world with an AI system, nothing to trace against so the line of sight checks stay cheap and the queue handling shows
+	UWorld * CreateTestWorld()
+	{
+		UWorld * World = UWorld::CreateWorld(EWorldType::Game, false);
+		FWorldContext & WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+		return World;
+	}
+
+	void DestroyTestWorld(UWorld * World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	// A row of listeners facing a row of targets, every listener gets a query for every target
+	UAISense_Sight_VR * SetUpQueries(UWorld * World, int32 NumActors)
+	{
+		UAIPerceptionSystem * PerceptionSystem = UAIPerceptionSystem::GetCurrent(World);
+		if (!PerceptionSystem)
+			return nullptr;
+
+		const float Spacing = 100.0f;
+
+		for (int32 i = 0; i < NumActors; ++i)
+		{
+			const FVector RowLocation(i * Spacing, 0.0f, 100.0f);
+
+			// Varied facing so that some targets fall outside of the sight pie
+			AAIController * Controller = World->SpawnActor<AAIController>(RowLocation, FRotator(0.0f, 90.0f + (i * 37) % 180, 0.0f));
+
+			UAISenseConfig_Sight_VR * SightConfig = NewObject<UAISenseConfig_Sight_VR>(Controller);
+			SightConfig->SightRadius = Spacing * NumActors * 2.0f;
+			SightConfig->LoseSightRadius = SightConfig->SightRadius * 1.2f;
+			SightConfig->DetectionByAffiliation.bDetectEnemies = true;
+			SightConfig->DetectionByAffiliation.bDetectNeutrals = true;
+			SightConfig->DetectionByAffiliation.bDetectFriendlies = true;
+
+			UAIPerceptionComponent * Perception = NewObject<UAIPerceptionComponent>(Controller);
+			Perception->ConfigureSense(*SightConfig);
+			Perception->RegisterComponent();
+
+			APawn * Target = World->SpawnActor<ADefaultPawn>(RowLocation + FVector(0.0f, Spacing * 5.0f, 0.0f), FRotator::ZeroRotator);
+			UAIPerceptionSystem::RegisterPerceptionStimuliSource(World, UAISense_Sight_VR::StaticClass(), Target);
+		}
+
+		// Processes the pending listener and source registrations
+		PerceptionSystem->Tick(0.0f);
+
+		return Cast<UAISense_Sight_VR>(PerceptionSystem->GetSenseInstance(UAISense::GetSenseID<UAISense_Sight_VR>()));
+	}
+
+	// Average time of one sense update, the same way the perception system ticks it
+	double TimeUpdates(UAISense_Sight_VR * Sense, bool bUseQuerySelection)
+	{
+		UBoolProperty * SelectionProperty = FindField<UBoolProperty>(UAISense_Sight_VR::StaticClass(), TEXT("bUseQuerySelection"));
+		SelectionProperty->SetPropertyValue_InContainer(Sense, bUseQuerySelection);
+
+		double TotalSeconds = 0.0;
+		for (int32 Update = 0; Update < NumUpdates; ++Update)
+		{
+			Sense->ProgressTime(BIG_NUMBER);
+
+			const double StartTime = FPlatformTime::Seconds();
+			Sense->Tick();
+			TotalSeconds += FPlatformTime::Seconds() - StartTime;
+		}
+
+		return (TotalSeconds * 1000.0) / NumUpdates;
+	}
+}
+
+bool FVRAISightQueryBenchmark::RunTest(const FString& Parameters)
+{
+	// Listeners and targets each, for 1k, 4k and 16k queries
+	const int32 ActorCounts[] = { 32, 64, 128 };
+
+	for (int32 NumActors : ActorCounts)
+	{
+		UWorld * World = VRAISightQueryBenchmark::CreateTestWorld();
+		UAISense_Sight_VR * Sense = VRAISightQueryBenchmark::SetUpQueries(World, NumActors);
+
+		if (!TestNotNull(TEXT("Sight sense exists"), Sense))
+		{
+			VRAISightQueryBenchmark::DestroyTestWorld(World);
+			return false;
+		}
+
+		const int32 NumQueries = Sense->SightQueryQueue.Num();
+		TestEqual(FString::Printf(TEXT("Each of the %d listeners has a query for every target"), NumActors), NumQueries, NumActors * NumActors);
+
+		// Alternate so that neither path gets the warm caches
+		double SortedMs = 0.0;
+		double SelectionMs = 0.0;
+		for (int32 Pass = 0; Pass < 2; ++Pass)
+		{
+			SortedMs += VRAISightQueryBenchmark::TimeUpdates(Sense, false) * 0.5;
+			SelectionMs += VRAISightQueryBenchmark::TimeUpdates(Sense, true) * 0.5;
+		}
+
+		TestEqual(TEXT("Updates don't lose queries"), Sense->SightQueryQueue.Num(), NumQueries);
+
+		AddInfo(FString::Printf(TEXT("%d queries, average Update(): sorted %.3fms selection %.3fms"), NumQueries, SortedMs, SelectionMs));
+
+		VRAISightQueryBenchmark::DestroyTestWorld(World);
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,197 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GripMotionControllerComponent.h"
+#include "Components/SceneComponent.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRGripIndexTest, "VRExpansionPlugin.GripIndex", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+namespace VRGripIndexTest
+{
+	// Every grip ID and object against the FindByKey searches that the index replaced
+	bool MatchesLinearSearch(FAutomationTestBase & Test, UGripMotionControllerComponent * Controller, const TArray<UObject*> & Objects, int32 Step)
+	{
+		for (int32 ID = 0; ID <= MAX_uint8; ++ID)
+		{
+			const uint8 GripID = (uint8)ID;
+			if (Controller->FindReplicatedGrip(GripID) != Controller->GrippedObjects.Grips.FindByKey(GripID) ||
+				Controller->FindLocalGrip(GripID) != Controller->LocallyGrippedObjects.Grips.FindByKey(GripID))
+			{
+				Test.AddError(FString::Printf(TEXT("Step %d: grip ID %d doesn't match the linear search"), Step, ID));
+				return false;
+			}
+		}
+
+		for (const UObject * Object : Objects)
+		{
+			if (Controller->FindReplicatedGrip(Object) != Controller->GrippedObjects.Grips.FindByKey(Object) ||
+				Controller->FindLocalGrip(Object) != Controller->LocallyGrippedObjects.Grips.FindByKey(Object))
+			{
+				Test.AddError(FString::Printf(TEXT("Step %d: object %s doesn't match the linear search"), Step, *GetNameSafe(Object)));
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// Same lookup and removal that DropGrip does, through the index or the linear search it replaced
+	bool DropReplicatedGrip(UGripMotionControllerComponent * Controller, uint8 GripID, bool bUseIndex)
+	{
+		const int32 Index = bUseIndex ? Controller->GrippedObjectsIndex.IndexOf(Controller->GrippedObjects.Grips, GripID) : Controller->GrippedObjects.Grips.IndexOfByKey(GripID);
+		if (Index == INDEX_NONE)
+			return false;
+
+		if (bUseIndex)
+		{
+			Controller->RemoveReplicatedGripAt(Index);
+		}
+		else
+		{
+			Controller->GrippedObjects.RemoveGripAt(Index);
+		}
+
+		return true;
+	}
+}
+
+bool FVRGripIndexTest::RunTest(const FString& Parameters)
+{
+	const int32 NumSteps = 5000;
+	const int32 NumObjects = 48;
+	const int32 MaxGrips = 64;
+
+	FRandomStream Random(4242);
+
+	// Same object gripped more than once is allowed, the first grip has to win
+	TArray<UObject*> Objects;
+	for (int32 i = 0; i < NumObjects; ++i)
+	{
+		Objects.Add(NewObject<USceneComponent>(GetTransientPackage()));
+	}
+
+	UGripMotionControllerComponent * Controller = NewObject<UGripMotionControllerComponent>(GetTransientPackage());
+	uint8 NextGripID = INVALID_VRGRIP_ID;
+
+	for (int32 Step = 0; Step < NumSteps; ++Step)
+	{
+		const float Action = Random.FRand();
+		const bool bLocal = Random.FRand() < 0.5f;
+		FBPActorGripArray & GripArray = bLocal ? Controller->LocallyGrippedObjects : Controller->GrippedObjects;
+
+		if (GripArray.Grips.Num() == 0 || (GripArray.Grips.Num() < MaxGrips && Action < 0.5f))
+		{
+			// Grip, IDs wrap around like GetNextGripID so they get reused while older grips are still held
+			if (++NextGripID == INVALID_VRGRIP_ID)
+				++NextGripID;
+
+			FBPActorGripInformation NewGrip;
+			NewGrip.GripID = NextGripID;
+			NewGrip.GrippedObject = Objects[Random.RandHelper(NumObjects)];
+
+			if (bLocal)
+				Controller->AddLocalGrip(NewGrip);
+			else
+				Controller->AddReplicatedGrip(NewGrip);
+		}
+		else if (Action < 0.9f)
+		{
+			// Drop
+			const int32 Index = Random.RandHelper(GripArray.Grips.Num());
+
+			if (bLocal)
+				Controller->RemoveLocalGripAt(Index);
+			else
+				Controller->RemoveReplicatedGripAt(Index);
+		}
+		else
+		{
+			// Replicated removal, the fast array swaps the last grip in and the OnRep picks it up
+			const int32 Index = Random.RandHelper(GripArray.Grips.Num());
+			GripArray.Grips[Index].PreReplicatedRemove(GripArray);
+			GripArray.Grips.RemoveAtSwap(Index);
+
+			if (bLocal)
+				Controller->OnRep_LocallyGrippedObjects();
+			else
+				Controller->OnRep_GrippedObjects();
+		}
+
+		if (!VRGripIndexTest::MatchesLinearSearch(*this, Controller, Objects, Step))
+			return false;
+	}
+
+	// Drop everything
+	while (Controller->GrippedObjects.Grips.Num() || Controller->LocallyGrippedObjects.Grips.Num())
+	{
+		if (Controller->GrippedObjects.Grips.Num())
+			Controller->RemoveReplicatedGripAt(Random.RandHelper(Controller->GrippedObjects.Grips.Num()));
+
+		if (Controller->LocallyGrippedObjects.Grips.Num())
+			Controller->RemoveLocalGripAt(Random.RandHelper(Controller->LocallyGrippedObjects.Grips.Num()));
+
+		if (!VRGripIndexTest::MatchesLinearSearch(*this, Controller, Objects, NumSteps))
+			return false;
+	}
+
+	// Timings are only reported, they depend too much on the machine to assert on
+	// Every grip ID held at once with unique objects, then dropped in random order
+	const int32 NumTimedGrips = MAX_uint8;
+	const int32 NumRounds = 20;
+
+	TArray<UObject*> TimedObjects;
+	for (int32 i = 0; i < NumTimedGrips; ++i)
+	{
+		TimedObjects.Add(NewObject<USceneComponent>(GetTransientPackage()));
+	}
+
+	double IndexedMs = 0.0;
+	double LinearMs = 0.0;
+	int32 NumDropped = 0;
+
+	for (int32 Round = 0; Round < NumRounds * 2; ++Round)
+	{
+		const bool bUseIndex = (Round & 1) == 0;
+
+		TArray<uint8> DropOrder;
+		for (int32 i = 0; i < NumTimedGrips; ++i)
+		{
+			FBPActorGripInformation NewGrip;
+			NewGrip.GripID = (uint8)(i + 1);
+			NewGrip.GrippedObject = TimedObjects[i];
+			Controller->AddReplicatedGrip(NewGrip);
+			DropOrder.Insert(NewGrip.GripID, Random.RandHelper(DropOrder.Num() + 1));
+		}
+
+		// Same lookups the tick does per grip, then the drops
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumTimedGrips; ++i)
+		{
+			const FBPActorGripInformation * Found = bUseIndex ? Controller->FindReplicatedGrip(TimedObjects[i]) : Controller->GrippedObjects.Grips.FindByKey(TimedObjects[i]);
+			NumDropped += Found ? 0 : 1;
+		}
+
+		for (uint8 GripID : DropOrder)
+		{
+			NumDropped += VRGripIndexTest::DropReplicatedGrip(Controller, GripID, bUseIndex) ? 1 : 0;
+		}
+
+		(bUseIndex ? IndexedMs : LinearMs) += (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		// The linear rounds bypass the helpers, so start the next round from a rebuilt index
+		if (!bUseIndex)
+			Controller->MarkGripIndexDirty();
+	}
+
+	TestEqual(TEXT("Every timed grip was found and dropped"), NumDropped, NumTimedGrips * NumRounds * 2);
+
+	AddInfo(FString::Printf(TEXT("%d rounds of %d grips looked up and dropped: indexed %.3fms linear %.3fms"),
+		NumRounds, NumTimedGrips, IndexedMs, LinearMs));
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
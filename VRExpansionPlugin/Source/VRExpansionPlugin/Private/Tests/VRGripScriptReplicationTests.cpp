@@ -0,0 +1,111 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GripScripts/GS_Default.h"
+#include "Engine/ActorChannel.h"
+#include "Net/DataReplication.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRGripScriptReplicationBenchmark, "VRExpansionPlugin.GripScriptReplication", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+namespace VRGripScriptReplicationBenchmark
+{
+	// Runs the grippables ReplicateSubobjects loop for every net update, returns how many scripts reached ReplicateSubobject
+	int32 RunNetUpdates(UActorChannel * Channel, const TArray<UVRGripScriptBase*> & Scripts, int32 NumNetUpdates, double & OutMs)
+	{
+		Channel->ReplicationMap.Reset();
+
+		int32 NumReplicated = 0;
+		const double StartTime = FPlatformTime::Seconds();
+
+		for (int32 NetUpdate = 0; NetUpdate < NumNetUpdates; ++NetUpdate)
+		{
+			FReplicationFlags RepFlags;
+			RepFlags.bNetInitial = NetUpdate == 0;
+
+			for (UVRGripScriptBase * Script : Scripts)
+			{
+				if (Script && !Script->IsPendingKill() && Script->ShouldReplicateToChannel(Channel, RepFlags))
+				{
+					// Stands in for ReplicateSubobject, which creates the channels replicator for the script the first time
+					if (!Channel->ReplicationMap.Contains(Script))
+						Channel->ReplicationMap.Add(Script, MakeShareable(new FObjectReplicator()));
+
+					++NumReplicated;
+				}
+			}
+		}
+
+		OutMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		Channel->ReplicationMap.Reset();
+		return NumReplicated;
+	}
+}
+
+bool FVRGripScriptReplicationBenchmark::RunTest(const FString& Parameters)
+{
+	// Matches a server with 2000 grippable props carrying two scripts each, seen by one client
+	const int32 NumGrippables = 2000;
+	const int32 NumScriptsPerGrippable = 2;
+	const int32 NumNetUpdates = 30;
+
+	IConsoleVariable * ConditionalReplication = IConsoleManager::Get().FindConsoleVariable(TEXT("vre.ConditionalGripScriptReplication"));
+	if (!TestNotNull(TEXT("vre.ConditionalGripScriptReplication exists"), ConditionalReplication))
+		return false;
+
+	const int32 PreviousSetting = ConditionalReplication->GetInt();
+
+	TArray<UVRGripScriptBase*> Scripts;
+	for (int32 i = 0; i < NumGrippables * NumScriptsPerGrippable; ++i)
+	{
+		Scripts.Add(NewObject<UGS_Default>(GetTransientPackage()));
+	}
+
+	UActorChannel * Channel = NewObject<UActorChannel>(GetTransientPackage());
+
+	double AlwaysMs = 0.0;
+	ConditionalReplication->Set(0, ECVF_SetByCode);
+	const int32 AlwaysReplicated = VRGripScriptReplicationBenchmark::RunNetUpdates(Channel, Scripts, NumNetUpdates, AlwaysMs);
+
+	double ConditionalMs = 0.0;
+	ConditionalReplication->Set(1, ECVF_SetByCode);
+	const int32 ConditionalReplicated = VRGripScriptReplicationBenchmark::RunNetUpdates(Channel, Scripts, NumNetUpdates, ConditionalMs);
+
+	// Scripts with replicated properties and bReplicateOnlyWhenDirty go out again once marked
+	UVRGripScriptBase * DirtyScript = Scripts[0];
+	DirtyScript->bReplicateOnlyWhenDirty = true;
+	FReplicationFlags RepFlags;
+	Channel->ReplicationMap.Add(DirtyScript, MakeShareable(new FObjectReplicator()));
+	const bool bHasReplicatedProperties = DirtyScript->GetClass()->ClassReps.Num() > 0;
+	const bool bFirstUpdate = DirtyScript->ShouldReplicateToChannel(Channel, RepFlags);
+	const bool bCleanUpdate = DirtyScript->ShouldReplicateToChannel(Channel, RepFlags);
+	DirtyScript->MarkReplicatedStateDirty();
+	const bool bDirtyUpdate = DirtyScript->ShouldReplicateToChannel(Channel, RepFlags);
+	Channel->ReplicationMap.Reset();
+
+	ConditionalReplication->Set(PreviousSetting, ECVF_SetByCode);
+
+	AddInfo(FString::Printf(TEXT("%d grip scripts over %d net updates, ReplicateSubobject calls: always %d (%.3fms) conditional %d (%.3fms)"),
+		Scripts.Num(), NumNetUpdates, AlwaysReplicated, AlwaysMs, ConditionalReplicated, ConditionalMs));
+
+	TestEqual(TEXT("Every script replicates on every net update when conditional replication is off"), AlwaysReplicated, Scripts.Num() * NumNetUpdates);
+	TestEqual(TEXT("Scripts without replicated properties only replicate initially"), ConditionalReplicated, Scripts.Num());
+
+	if (bHasReplicatedProperties)
+	{
+		TestTrue(TEXT("Dirty tracked script replicates the first time"), bFirstUpdate);
+		TestFalse(TEXT("Dirty tracked script is skipped while clean"), bCleanUpdate);
+		TestTrue(TEXT("Dirty tracked script replicates again once marked"), bDirtyUpdate);
+	}
+	else
+	{
+		TestFalse(TEXT("Script without replicated properties is skipped after the initial replication"), bFirstUpdate || bCleanUpdate || bDirtyUpdate);
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
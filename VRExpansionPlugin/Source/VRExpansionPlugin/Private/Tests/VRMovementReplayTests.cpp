@@ -0,0 +1,235 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VRMovementReplay.h"
+#include "VRCharacter.h"
+#include "VRCharacterMovementComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/GameNetworkManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRMovementReplayTest, "VRExpansionPlugin.MovementReplay", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRMovementMergingTest, "VRExpansionPlugin.MovementMerging", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+namespace VRMovementReplayTest
+{
+	// Generous so that slow build machines pass, a regression in the movement shows up as a multiple of this
+	const double MaxAverageMoveMs = 1.0;
+
+	// Walking on a flat floor finds the floor once per move, plus the retries and step downs of a few moves
+	const uint32 MaxFloorSweepsPerMove = 4;
+
+	// A session captured on a flat floor at Z 0 (vr.MovementRecordStart in an empty map) can be checked in here, it is replayed along with the scripted one
+	FString GetCheckedInRecordingPath()
+	{
+		return FPaths::Combine(FPaths::ProjectPluginsDir(), TEXT("VRExpansionPlugin"), TEXT("Resources"), TEXT("Tests"), TEXT("VRMovementReplay.vrmove"));
+	}
+
+	// Game world with a large flat floor at Z 0
+	UWorld * CreateTestWorld()
+	{
+		UWorld * World = UWorld::CreateWorld(EWorldType::Game, false);
+		FWorldContext & WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+
+		UStaticMesh * Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+		AStaticMeshActor * Floor = World->SpawnActor<AStaticMeshActor>(FVector(0.0f, 0.0f, -50.0f), FRotator::ZeroRotator);
+
+		if (Floor && Cube)
+		{
+			Floor->GetStaticMeshComponent()->SetStaticMesh(Cube);
+			Floor->SetActorScale3D(FVector(200.0f, 200.0f, 1.0f));
+		}
+
+		return World;
+	}
+
+	void DestroyTestWorld(UWorld * World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	// Standing on the floor so that recordings start walking
+	AVRCharacter * SpawnCharacter(UWorld * World)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		AVRCharacter * Character = World->SpawnActor<AVRCharacter>(AVRCharacter::StaticClass(), FVector(0.0f, 0.0f, 100.0f), FRotator::ZeroRotator, SpawnParams);
+
+		if (Character)
+			Character->TeleportTo(FVector(0.0f, 0.0f, Character->GetCapsuleComponent()->GetScaledCapsuleHalfHeight() + 2.0f), FRotator::ZeroRotator, false, true);
+
+		return Character;
+	}
+
+	// Walk, strafe and stop at 90hz while the HMD drifts around the play space, with a snap turn half way.
+	// Accelerations are whole numbers so that the servers quantized copy matches the clients.
+	FVRMovementRecording BuildScriptedInput(AVRCharacter * Character)
+	{
+		FVRMovementRecording Recording;
+		Recording.Begin(Character);
+
+		const int32 NumMoves = 900;
+		const float DeltaTime = 1.0f / 90.0f;
+		FVector LastHMDLocation(0.0f, 20.0f, 170.0f);
+
+		for (int32 i = 0; i < NumMoves; ++i)
+		{
+			FVRRecordedMove & Move = Recording.Moves[Recording.Moves.AddDefaulted()];
+			Move.DeltaTime = DeltaTime;
+			Move.TimeStamp = (i + 1) * DeltaTime;
+
+			const int32 Phase = (i * 4) / NumMoves;
+			Move.Acceleration = Phase == 0 ? FVector(2048.0f, 0.0f, 0.0f) : Phase == 1 ? FVector(0.0f, 2048.0f, 0.0f) : Phase == 2 ? FVector(-1448.0f, -1448.0f, 0.0f) : FVector::ZeroVector;
+
+			// Standing in place and leaning around, the capsule follows through LFDiff
+			const float Time = Move.TimeStamp;
+			const FVector HMDLocation(FMath::Sin(Time * 0.7f) * 30.0f, FMath::Cos(Time * 0.5f) * 20.0f, 170.0f);
+			const FRotator HMDRotation(0.0f, FMath::Sin(Time * 0.3f) * 45.0f, 0.0f);
+
+			Move.HMDRelativeTransform = FTransform(HMDRotation, HMDLocation);
+			Move.LeftControllerRelativeTransform = FTransform(HMDRotation, HMDLocation + FVector(30.0f, -20.0f, -40.0f));
+			Move.RightControllerRelativeTransform = FTransform(HMDRotation, HMDLocation + FVector(30.0f, 20.0f, -40.0f));
+			Move.VRCapsuleLocation = HMDLocation;
+			Move.VRCapsuleRotation = HMDRotation;
+			Move.LFDiff = FVector(HMDLocation.X - LastHMDLocation.X, HMDLocation.Y - LastHMDLocation.Y, 0.0f);
+			Move.ControlRotation = FRotator(0.0f, HMDRotation.Yaw, 0.0f);
+			Move.CompressedFlags = (uint8)EVRConjoinedMovementModes::C_MOVE_MAX << 2;
+			LastHMDLocation = HMDLocation;
+
+			if (i == NumMoves / 2)
+			{
+				FVRMoveActionContainer SnapTurn;
+				SnapTurn.MoveAction = EVRMoveAction::VRMOVEACTION_SnapTurn;
+				SnapTurn.MoveActionRot = FRotator(0.0f, 45.0f, 0.0f);
+				Move.MoveActions.Add(SnapTurn);
+			}
+		}
+
+		return Recording;
+	}
+
+	// Client locations come from a client replay of the scripted input
+	FVRMovementRecording CaptureScriptedInput(AVRCharacter * Character)
+	{
+		FVRMovementRecording Captured;
+		FVRMovementReplay::Replay(Character, BuildScriptedInput(Character), false, &Captured);
+		return Captured;
+	}
+
+	void TestReplay(FAutomationTestBase & Test, AVRCharacter * Character, const FVRMovementRecording & Recording, const FString & Name)
+	{
+		for (int32 Path = 0; Path < 2; ++Path)
+		{
+			const bool bServerPath = Path == 1;
+			const FString PathName = FString::Printf(TEXT("%s (%s)"), *Name, bServerPath ? TEXT("server") : TEXT("client"));
+			const FVRMovementReplayReport Report = FVRMovementReplay::Replay(Character, Recording, bServerPath);
+
+			Test.AddInfo(FString::Printf(TEXT("%s: %s"), *PathName, *Report.ToString()));
+
+			Test.TestEqual(FString::Printf(TEXT("%s replays every move"), *PathName), Report.NumMoves, Recording.Moves.Num());
+			Test.TestEqual(FString::Printf(TEXT("%s has no corrections"), *PathName), Report.Corrections, 0);
+			Test.TestTrue(FString::Printf(TEXT("%s average move cost is under %.2fms"), *PathName, MaxAverageMoveMs), Report.NumMoves > 0 && Report.TotalMoveMs / Report.NumMoves < MaxAverageMoveMs);
+
+#if !UE_BUILD_SHIPPING
+			Test.TestTrue(FString::Printf(TEXT("%s counts floor and move sweeps"), *PathName), Report.FloorSweeps > 0 && Report.MoveSweeps > 0);
+			Test.TestTrue(FString::Printf(TEXT("%s needs at most %u floor sweeps per move"), *PathName, MaxFloorSweepsPerMove), Report.FloorSweeps <= (uint32)Report.NumMoves * MaxFloorSweepsPerMove);
+#endif
+		}
+	}
+}
+
+bool FVRMovementReplayTest::RunTest(const FString& Parameters)
+{
+	UWorld * World = VRMovementReplayTest::CreateTestWorld();
+	AVRCharacter * Character = VRMovementReplayTest::SpawnCharacter(World);
+
+	if (!TestNotNull(TEXT("VRCharacter spawns"), Character))
+	{
+		VRMovementReplayTest::DestroyTestWorld(World);
+		return false;
+	}
+
+	// The file format round trip is part of the test
+	const FVRMovementRecording Captured = VRMovementReplayTest::CaptureScriptedInput(Character);
+
+	const FString FileName = TEXT("AutomationTest.vrmove");
+	FVRMovementRecording Scripted;
+	TestTrue(TEXT("Recording saves"), Captured.SaveToFile(FileName));
+	TestTrue(TEXT("Recording loads"), Scripted.LoadFromFile(FileName));
+	TestEqual(TEXT("Recording keeps every move"), Scripted.Moves.Num(), Captured.Moves.Num());
+
+	VRMovementReplayTest::TestReplay(*this, Character, Scripted, TEXT("Scripted"));
+
+	FVRMovementRecording CheckedIn;
+	if (CheckedIn.LoadFromFile(VRMovementReplayTest::GetCheckedInRecordingPath()))
+	{
+		VRMovementReplayTest::TestReplay(*this, Character, CheckedIn, FPaths::GetCleanFilename(VRMovementReplayTest::GetCheckedInRecordingPath()));
+	}
+	else
+	{
+		AddInfo(FString::Printf(TEXT("No captured session at %s, only the scripted input was replayed"), *VRMovementReplayTest::GetCheckedInRecordingPath()));
+	}
+
+	Character->Destroy();
+	VRMovementReplayTest::DestroyTestWorld(World);
+	return true;
+}
+
+bool FVRMovementMergingTest::RunTest(const FString& Parameters)
+{
+	UWorld * World = VRMovementReplayTest::CreateTestWorld();
+	AVRCharacter * Character = VRMovementReplayTest::SpawnCharacter(World);
+
+	if (!TestNotNull(TEXT("VRCharacter spawns"), Character))
+	{
+		VRMovementReplayTest::DestroyTestWorld(World);
+		return false;
+	}
+
+	const FVRMovementRecording Scripted = VRMovementReplayTest::CaptureScriptedInput(Character);
+
+	// The same client input with and without combining, each with the moves it would send
+	FVRMovementRecording SeparateMoves;
+	FVRMovementRecording CombinedMoves;
+	const FVRMovementReplayReport Separate = FVRMovementReplay::Replay(Character, Scripted, false, &SeparateMoves, false);
+	const FVRMovementReplayReport Combined = FVRMovementReplay::Replay(Character, Scripted, false, &CombinedMoves, true);
+
+	// And what the server makes of each stream
+	const FVRMovementReplayReport ServerSeparate = FVRMovementReplay::Replay(Character, SeparateMoves, true);
+	const FVRMovementReplayReport ServerCombined = FVRMovementReplay::Replay(Character, CombinedMoves, true);
+
+	AddInfo(FString::Printf(TEXT("Client separate: %s"), *Separate.ToString()));
+	AddInfo(FString::Printf(TEXT("Client combined: %s"), *Combined.ToString()));
+	AddInfo(FString::Printf(TEXT("Server separate: %s"), *ServerSeparate.ToString()));
+	AddInfo(FString::Printf(TEXT("Server combined: %s"), *ServerCombined.ToString()));
+
+	TestEqual(TEXT("Separate moves send every move"), Separate.ServerMoves, Scripted.Moves.Num());
+	TestTrue(TEXT("Combining sends fewer server moves"), Combined.ServerMoves < Separate.ServerMoves);
+	TestEqual(TEXT("Every combined move is in the sent stream"), CombinedMoves.Moves.Num(), Combined.ServerMoves);
+	TestEqual(TEXT("Combined client moves are corrected as often as separate ones"), Combined.Corrections, Separate.Corrections);
+	TestEqual(TEXT("Server corrects combined moves as often as separate ones"), ServerCombined.Corrections, ServerSeparate.Corrections);
+
+	if (TestTrue(TEXT("Both streams have moves"), SeparateMoves.Moves.Num() > 0 && CombinedMoves.Moves.Num() > 0))
+	{
+		const FVector EndDifference = CombinedMoves.Moves.Last().ClientLocation - SeparateMoves.Moves.Last().ClientLocation;
+		TestFalse(FString::Printf(TEXT("Combined moves end where separate moves do (%s apart)"), *EndDifference.ToString()),
+			GetDefault<AGameNetworkManager>()->ExceedsAllowablePositionError(EndDifference));
+	}
+
+	Character->Destroy();
+	VRMovementReplayTest::DestroyTestWorld(World);
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,84 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VRBaseCharacter.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRSeatThresholdTest, "VRExpansionPlugin.SeatThreshold", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRSeatThresholdTest::RunTest(const FString& Parameters)
+{
+	// Same as the vre.SeatThresholdHysteresis and vre.SeatThresholdScalerStep defaults
+	const float Hysteresis = 1.0f;
+	const float ScalerStep = 0.02f;
+
+	FVRSeatedCharacterInfo SeatInfo;
+	SeatInfo.AllowedRadius = 40.0f;
+	SeatInfo.AllowedRadiusThreshold = 20.0f;
+	const float ThresholdStart = SeatInfo.AllowedRadius - SeatInfo.AllowedRadiusThreshold;
+
+	TestFalse(TEXT("Head at the seat is within the threshold"), SeatInfo.UpdateThreshold(0.0f, Hysteresis, ScalerStep) || SeatInfo.bIsOverThreshold);
+
+	// Slowly leaning out to the allowed radius fires once per scaler step instead of every frame
+	const int32 NumFrames = 2000;
+	int32 NumEvents = 0;
+	for (int32 Frame = 1; Frame <= NumFrames; ++Frame)
+	{
+		if (SeatInfo.UpdateThreshold(ThresholdStart + (SeatInfo.AllowedRadiusThreshold * Frame) / NumFrames, Hysteresis, ScalerStep))
+			++NumEvents;
+	}
+
+	TestTrue(TEXT("Head at the allowed radius is over the threshold"), SeatInfo.bIsOverThreshold);
+	TestEqual(TEXT("Last event was sent with the full scaler"), SeatInfo.LastBroadcastScaler, 1.0f);
+	TestTrue(FString::Printf(TEXT("Events while leaning out are coalesced (%d over %d frames)"), NumEvents, NumFrames),
+		NumEvents >= 2 && NumEvents <= FMath::CeilToInt(1.0f / ScalerStep) + 2);
+
+	// Resting on the edge of the threshold doesn't flip the state, only dropping below the hysteresis band does
+	int32 NumStateChanges = 0;
+	bool bWasOverThreshold = SeatInfo.bIsOverThreshold;
+	for (int32 Frame = 0; Frame < 100; ++Frame)
+	{
+		SeatInfo.UpdateThreshold(ThresholdStart + ((Frame & 1) ? Hysteresis * 0.5f : -Hysteresis * 0.5f), Hysteresis, ScalerStep);
+		NumStateChanges += SeatInfo.bIsOverThreshold != bWasOverThreshold ? 1 : 0;
+		bWasOverThreshold = SeatInfo.bIsOverThreshold;
+	}
+
+	TestEqual(TEXT("Head jittering across the threshold stays over it"), NumStateChanges, 0);
+	TestTrue(TEXT("Head inside the hysteresis band is still over the threshold"), SeatInfo.bIsOverThreshold);
+
+	TestTrue(TEXT("Dropping below the hysteresis band fires"), SeatInfo.UpdateThreshold(ThresholdStart - Hysteresis * 1.5f, Hysteresis, ScalerStep));
+	TestFalse(TEXT("Head below the hysteresis band is within the threshold"), SeatInfo.bIsOverThreshold);
+
+	// Jittering just inside the threshold start never crosses it once back within
+	NumEvents = 0;
+	for (int32 Frame = 0; Frame < 100; ++Frame)
+	{
+		if (SeatInfo.UpdateThreshold(ThresholdStart - ((Frame & 1) ? Hysteresis * 0.25f : Hysteresis * 0.75f), Hysteresis, ScalerStep))
+			++NumEvents;
+	}
+
+	TestEqual(TEXT("No events while resting within the threshold"), NumEvents, 0);
+	TestFalse(TEXT("Head resting within the threshold stays within it"), SeatInfo.bIsOverThreshold);
+
+	// Leaving the seat clears the state, so the next seat starts within the threshold instead of inheriting the hysteresis
+	SeatInfo.UpdateThreshold(SeatInfo.AllowedRadius, Hysteresis, ScalerStep);
+	TestTrue(TEXT("Over the threshold before ClearTempVals"), SeatInfo.bIsOverThreshold);
+	SeatInfo.ClearTempVals();
+	TestFalse(TEXT("ClearTempVals resets bIsOverThreshold"), SeatInfo.bIsOverThreshold);
+	TestEqual(TEXT("ClearTempVals resets the broadcast scaler"), SeatInfo.LastBroadcastScaler, 0.0f);
+	TestFalse(TEXT("Inside the hysteresis band after ClearTempVals doesn't fire"), SeatInfo.UpdateThreshold(ThresholdStart - Hysteresis * 0.5f, Hysteresis, ScalerStep));
+	TestFalse(TEXT("Inside the hysteresis band after ClearTempVals is within the threshold"), SeatInfo.bIsOverThreshold);
+
+	SeatInfo.UpdateThreshold(SeatInfo.AllowedRadius, Hysteresis, ScalerStep);
+	TestTrue(TEXT("Over the threshold before Clear"), SeatInfo.bIsOverThreshold);
+	SeatInfo.Clear();
+	TestFalse(TEXT("Clear resets bIsOverThreshold"), SeatInfo.bIsOverThreshold);
+	TestEqual(TEXT("Clear resets the broadcast scaler"), SeatInfo.LastBroadcastScaler, 0.0f);
+	TestFalse(TEXT("Inside the hysteresis band after Clear doesn't fire"), SeatInfo.UpdateThreshold(SeatInfo.AllowedRadius - SeatInfo.AllowedRadiusThreshold - Hysteresis * 0.5f, Hysteresis, ScalerStep));
+	TestFalse(TEXT("Inside the hysteresis band after Clear is within the threshold"), SeatInfo.bIsOverThreshold);
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,124 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interactibles/VRSplineLookupTable.h"
+#include "Components/SplineComponent.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRSplineLookupTableTest, "VRExpansionPlugin.SplineLookupTable", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+namespace VRSplineLookupTableTest
+{
+	// Every segment of the polyline, what the chunked search has to match
+	float FindClosestDistSqLinear(const FVRSplineLookupTable & Table, const FVector & Location)
+	{
+		float ClosestDistSq = BIG_NUMBER;
+
+		for (int32 i = 0; i < Table.Positions.Num() - 1; ++i)
+		{
+			const FVector Start = Table.Positions[i];
+			const FVector Segment = Table.Positions[i + 1] - Start;
+			const float SegmentSizeSq = Segment.SizeSquared();
+			const float Alpha = SegmentSizeSq > SMALL_NUMBER ? FMath::Clamp(FVector::DotProduct(Location - Start, Segment) / SegmentSizeSq, 0.0f, 1.0f) : 0.0f;
+			ClosestDistSq = FMath::Min(ClosestDistSq, FVector::DistSquared(Start + Segment * Alpha, Location));
+		}
+
+		return ClosestDistSq;
+	}
+}
+
+bool FVRSplineLookupTableTest::RunTest(const FString& Parameters)
+{
+	const int32 NumQueries = 2000;
+	const float MaxError = 0.5f;
+
+	FRandomStream Random(1337);
+
+	USplineComponent * Spline = NewObject<USplineComponent>(GetTransientPackage());
+
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		const bool bClosedLoop = Pass == 1;
+
+		TArray<FVector> Points;
+		for (int32 i = 0; i < 16; ++i)
+		{
+			Points.Add(FVector(i * 200.0f, Random.FRandRange(-500.0f, 500.0f), Random.FRandRange(-200.0f, 200.0f)));
+		}
+
+		Spline->SetSplinePoints(Points, ESplineCoordinateSpace::Local, false);
+		Spline->SetClosedLoop(bClosedLoop, true);
+
+		FVRSplineLookupTable Table;
+		if (!TestTrue(TEXT("Table builds"), Table.Update(Spline, MaxError)))
+			return false;
+
+		TArray<FVector> Queries;
+		for (int32 i = 0; i < NumQueries; ++i)
+		{
+			Queries.Add(FVector(Random.FRandRange(-500.0f, 3500.0f), Random.FRandRange(-1000.0f, 1000.0f), Random.FRandRange(-500.0f, 500.0f)));
+		}
+
+		// The polyline is only within the measured error of the curve, allow for it on both ends plus float noise
+		const float Tolerance = Table.MeasuredError * 2.0f + 0.1f;
+
+		for (const FVector & Query : Queries)
+		{
+			float Distance = 0.0f;
+			const float Key = Table.FindInputKeyClosestToWorldLocation(Spline, Query, &Distance);
+			const FVector TableLocation = Spline->GetLocationAtSplineInputKey(Key, ESplineCoordinateSpace::Local);
+			const FVector SplineLocation = Spline->GetLocationAtSplineInputKey(Spline->FindInputKeyClosestToWorldLocation(Query), ESplineCoordinateSpace::Local);
+
+			if (!TestTrue(FString::Printf(TEXT("Closest point to %s is as close as the splines own search"), *Query.ToString()),
+				FVector::Dist(TableLocation, Query) <= FVector::Dist(SplineLocation, Query) + Tolerance))
+			{
+				return false;
+			}
+
+			// The returned distance points back at the polyline location that was found
+			const float Sample = Distance / Table.SampleDistance;
+			const int32 Index = FMath::Min(FMath::FloorToInt(Sample), Table.Positions.Num() - 2);
+			const FVector PolylineLocation = FMath::Lerp(Table.Positions[Index], Table.Positions[Index + 1], Sample - Index);
+			const float LinearDist = FMath::Sqrt(VRSplineLookupTableTest::FindClosestDistSqLinear(Table, Query));
+
+			if (!TestTrue(FString::Printf(TEXT("Chunked search matches the linear scan for %s"), *Query.ToString()),
+				FMath::IsNearlyEqual(FVector::Dist(PolylineLocation, Query), LinearDist, 0.01f)))
+			{
+				return false;
+			}
+		}
+
+		// Timings are only reported, they depend too much on the machine to assert on
+		float Sink = 0.0f;
+
+		double StartTime = FPlatformTime::Seconds();
+		for (const FVector & Query : Queries)
+		{
+			Sink += Table.FindInputKeyClosestToWorldLocation(Spline, Query);
+		}
+		const double ChunkedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		StartTime = FPlatformTime::Seconds();
+		for (const FVector & Query : Queries)
+		{
+			Sink += VRSplineLookupTableTest::FindClosestDistSqLinear(Table, Query);
+		}
+		const double LinearMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		StartTime = FPlatformTime::Seconds();
+		for (const FVector & Query : Queries)
+		{
+			Sink += Spline->FindInputKeyClosestToWorldLocation(Query);
+		}
+		const double SplineMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		AddInfo(FString::Printf(TEXT("%s: %d samples, error %.3f, %d queries: chunked %.3fms linear %.3fms spline %.3fms (%f)"),
+			bClosedLoop ? TEXT("Closed loop") : TEXT("Open"), Table.Positions.Num(), Table.MeasuredError, NumQueries, ChunkedMs, LinearMs, SplineMs, Sink));
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
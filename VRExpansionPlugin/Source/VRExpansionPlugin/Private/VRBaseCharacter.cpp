@@ -3,10 +3,32 @@
 #include "VRBaseCharacter.h"
 #include "NavigationSystem.h"
 #include "VRPathFollowingComponent.h"
+#include "HAL/IConsoleManager.h"
 //#include "Runtime/Engine/Private/EnginePrivate.h"
 
 DEFINE_LOG_CATEGORY(LogBaseVRCharacter);
 
+DECLARE_CYCLE_STAT(TEXT("Char TickSeatInformation"), STAT_CharTickSeatInformation, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Char SeatThreshold Events"), STAT_CharSeatThresholdEvents, STATGROUP_Character);
+
+namespace VRBaseCharacterCVars
+{
+	static float SeatThresholdHysteresis = 1.0f;
+	FAutoConsoleVariableRef CVarSeatThresholdHysteresis(
+		TEXT("vre.SeatThresholdHysteresis"),
+		SeatThresholdHysteresis,
+		TEXT("Distance in cm that a seated head has to move back inside of the threshold before it counts as within it again."),
+		ECVF_Default);
+
+	static float SeatThresholdScalerStep = 0.02f;
+	FAutoConsoleVariableRef CVarSeatThresholdScalerStep(
+		TEXT("vre.SeatThresholdScalerStep"),
+		SeatThresholdScalerStep,
+		TEXT("How far the seated threshold scaler has to move before OnSeatThreshholdChanged fires again, reaching 0 or 1 always fires.\n")
+		TEXT("0: Fire on every change"),
+		ECVF_Default);
+}
+
 FName AVRBaseCharacter::LeftMotionControllerComponentName(TEXT("Left Grip Motion Controller"));
 FName AVRBaseCharacter::RightMotionControllerComponentName(TEXT("Right Grip Motion Controller"));
 FName AVRBaseCharacter::ReplicatedCameraComponentName(TEXT("VR Replicated Camera"));
@@ -229,8 +251,7 @@ void AVRBaseCharacter::NotifyOfTeleport_Implementation()
 
 void AVRBaseCharacter::TickSeatInformation(float DeltaTime)
 {
-	float LastThresholdScaler = SeatInformation.CurrentThresholdScaler;
-	bool bLastOverThreshold = SeatInformation.bIsOverThreshold;
+	SCOPE_CYCLE_COUNTER(STAT_CharTickSeatInformation);
 
 	FVector NewLoc = VRReplicatedCamera->RelativeLocation;
 
@@ -257,15 +278,10 @@ void AVRBaseCharacter::TickSeatInformation(float DeltaTime)
 		SeatInformation.bWasOverLimit = false;
 	}
 
-	if (AbsDistance > SeatInformation.AllowedRadius - SeatInformation.AllowedRadiusThreshold)
-		SeatInformation.bIsOverThreshold = true;
-	else
-		SeatInformation.bIsOverThreshold = false;
-
-	SeatInformation.CurrentThresholdScaler = FMath::Clamp((AbsDistance - (SeatInformation.AllowedRadius - SeatInformation.AllowedRadiusThreshold)) / SeatInformation.AllowedRadiusThreshold, 0.0f, 1.0f);
-
-	if (bLastOverThreshold != SeatInformation.bIsOverThreshold || !FMath::IsNearlyEqual(LastThresholdScaler, SeatInformation.CurrentThresholdScaler))
+	if (SeatInformation.UpdateThreshold(AbsDistance, VRBaseCharacterCVars::SeatThresholdHysteresis, VRBaseCharacterCVars::SeatThresholdScalerStep))
 	{
+		INC_DWORD_STAT(STAT_CharSeatThresholdEvents);
+
 		OnSeatThreshholdChanged(!SeatInformation.bIsOverThreshold, SeatInformation.CurrentThresholdScaler);
 		OnSeatThreshholdChanged_Bind.Broadcast(!SeatInformation.bIsOverThreshold, SeatInformation.CurrentThresholdScaler);
 	}
@@ -11,6 +11,56 @@
 #include "VRRootComponent.h"
 #include "VRPlayerController.h"
 #include "GameFramework/PhysicsVolume.h"
+#include "Misc/VRMovementReplay.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Char Resting Ticks Skipped"), STAT_CharRestingTicksSkipped, STATGROUP_Character);
+
+namespace VRBaseCharacterMovementComponentStatics
+{
+	static float MaxCombinedVRInputDelta = 5.0f;
+	FAutoConsoleVariableRef CVarMaxCombinedVRInputDelta(
+		TEXT("vre.MaxCombinedVRInputDelta"),
+		MaxCombinedVRInputDelta,
+		TEXT("Largest HMD offset or direct VR movement (in uu) that two client moves can sum to and still be combined in to a single move.\n")
+		TEXT("Combined offsets are applied as one sweep, so larger values trade accuracy against obstacles for fewer server moves."),
+		ECVF_Default);
+
+	static int32 RestingEnterFrames = 10;
+	FAutoConsoleVariableRef CVarRestingEnterFrames(
+		TEXT("vre.RestingEnterFrames"),
+		RestingEnterFrames,
+		TEXT("Number of consecutive stationary frames before a VR character enters the resting state."),
+		ECVF_Default);
+
+	static int32 RestingTickInterval = 4;
+	FAutoConsoleVariableRef CVarRestingTickInterval(
+		TEXT("vre.RestingTickInterval"),
+		RestingTickInterval,
+		TEXT("While resting the movement tick only runs every this many frames, with the skipped time added to it.\n")
+		TEXT("1 or less: Disables the resting state"),
+		ECVF_Default);
+
+	static float RestingMaxSkippedTime = 0.1f;
+	FAutoConsoleVariableRef CVarRestingMaxSkippedTime(
+		TEXT("vre.RestingMaxSkippedTime"),
+		RestingMaxSkippedTime,
+		TEXT("Max seconds of movement ticks that a resting character skips in a row regardless of the interval."),
+		ECVF_Default);
+
+	static float RestingVelocityThreshold = 1.0f;
+	FAutoConsoleVariableRef CVarRestingVelocityThreshold(
+		TEXT("vre.RestingVelocityThreshold"),
+		RestingVelocityThreshold,
+		TEXT("Speed (uu/s) below which a character counts as stationary."),
+		ECVF_Default);
+
+	static float RestingHMDThreshold = 0.05f;
+	FAutoConsoleVariableRef CVarRestingHMDThreshold(
+		TEXT("vre.RestingHMDThreshold"),
+		RestingHMDThreshold,
+		TEXT("HMD movement (uu per frame) below which a character counts as stationary."),
+		ECVF_Default);
+}
 
 UVRBaseCharacterMovementComponent::UVRBaseCharacterMovementComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -57,6 +107,15 @@ UVRBaseCharacterMovementComponent::UVRBaseCharacterMovementComponent(const FObje
 	bIsInPushBack = false;
 
 	bRunControlRotationInMovementComponent = true;
+
+	bAllowRestingState = true;
+	bIsResting = false;
+	RestingCandidateFrames = 0;
+	RestingSkippedFrames = 0;
+	RestingSkippedTime = 0.0f;
+	RestingSkippedVRInput = FVector::ZeroVector;
+	RestingBaseLocation = FVector::ZeroVector;
+	RestingBaseRotation = FQuat::Identity;
 }
 
 void UVRBaseCharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
@@ -92,8 +151,10 @@ void UVRBaseCharacterMovementComponent::TickComponent(float DeltaTime, enum ELev
 		}
 
 	}
-	else
+	else if (!UpdateRestingState(DeltaTime))
+	{
 		Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	}
 
 
 	// This should be valid for both Simulated and owning clients as well as the server
@@ -107,6 +168,134 @@ void UVRBaseCharacterMovementComponent::TickComponent(float DeltaTime, enum ELev
 	}
 }
 
+void UVRBaseCharacterMovementComponent::WakeFromRest()
+{
+	// Skipped time is picked up by the next tick
+	bIsResting = false;
+	RestingCandidateFrames = 0;
+}
+
+bool UVRBaseCharacterMovementComponent::CanRest()
+{
+	using namespace VRBaseCharacterMovementComponentStatics;
+
+	if (!HasValidData() || !IsMovingOnGround() || UpdatedComponent->IsSimulatingPhysics())
+		return false;
+
+	// Turning is only applied by PerformMovement, the controller overwrites the input every frame
+	if (AVRPlayerController * PC = Cast<AVRPlayerController>(CharacterOwner->GetController()))
+	{
+		if (!PC->LastRotationInput.IsZero() || !PC->RotationInput.IsZero())
+			return false;
+	}
+
+	// Input, forces and anything that is queued up to move the character
+	if (!GetPendingInputVector().IsNearlyZero() || !Acceleration.IsNearlyZero() || bHasRequestedVelocity ||
+		!PendingLaunchVelocity.IsZero() || !PendingImpulseToApply.IsZero() || !PendingForceToApply.IsZero() ||
+		bJustTeleported || bForceNextFloorCheck || bWantsToCrouch != IsCrouching() ||
+		HasAnimRootMotion() || HasRootMotionSources())
+	{
+		return false;
+	}
+
+	if (Velocity.SizeSquared() > FMath::Square(RestingVelocityThreshold))
+		return false;
+
+	// VR specific movement
+	if ((RestingSkippedVRInput + AdditionalVRInputVector).SizeSquared() > FMath::Square(RestingHMDThreshold) || !CustomVRInputVector.IsZero() ||
+		MoveActionArray.MoveActions.Num() || VRReplicatedMovementMode != EVRConjoinedMovementModes::C_MOVE_MAX)
+	{
+		return false;
+	}
+
+	// Corrections and replicated updates
+	if (CharacterOwner->Role == ROLE_SimulatedProxy)
+	{
+		if (bNetworkUpdateReceived || bNetworkMovementModeChanged)
+			return false;
+
+		// Still smoothing towards the last update
+		if (HasPredictionData_Client())
+		{
+			FNetworkPredictionData_Client_Character* ClientData = GetPredictionData_Client_Character();
+			if (!ClientData->MeshTranslationOffset.IsNearlyZero())
+				return false;
+		}
+	}
+	else if (CharacterOwner->Role == ROLE_AutonomousProxy && HasPredictionData_Client())
+	{
+		if (GetPredictionData_Client_Character()->bUpdatePosition)
+			return false;
+	}
+
+	// A base that moved since last frame carries us with it
+	UPrimitiveComponent * MovementBase = CharacterOwner->GetMovementBase();
+	if (MovementBaseUtility::IsDynamicBase(MovementBase))
+	{
+		FVector BaseLocation;
+		FQuat BaseRotation;
+		MovementBaseUtility::GetMovementBaseTransform(MovementBase, CharacterOwner->GetBasedMovement().BoneName, BaseLocation, BaseRotation);
+
+		const bool bBaseMoved = (bIsResting || RestingCandidateFrames > 0) && (!BaseLocation.Equals(RestingBaseLocation) || !BaseRotation.Equals(RestingBaseRotation));
+		RestingBaseLocation = BaseLocation;
+		RestingBaseRotation = BaseRotation;
+
+		if (bBaseMoved)
+			return false;
+	}
+
+	return true;
+}
+
+bool UVRBaseCharacterMovementComponent::UpdateRestingState(float & DeltaTime)
+{
+	using namespace VRBaseCharacterMovementComponentStatics;
+
+	// The server only moves remote characters from their client moves, there is nothing to skip for them
+	const bool bCanEverRest = bAllowRestingState && RestingTickInterval > 1 && CharacterOwner &&
+		(CharacterOwner->IsLocallyControlled() || CharacterOwner->Role == ROLE_SimulatedProxy);
+
+	if (!bCanEverRest || !CanRest())
+	{
+		if (bIsResting)
+		{
+			WakeFromRest();
+		}
+
+		RestingCandidateFrames = 0;
+	}
+	else if (!bIsResting)
+	{
+		if (++RestingCandidateFrames >= RestingEnterFrames)
+		{
+			bIsResting = true;
+			RestingSkippedFrames = 0;
+		}
+	}
+	else if (++RestingSkippedFrames < RestingTickInterval && RestingSkippedTime + DeltaTime < RestingMaxSkippedTime)
+	{
+		RestingSkippedTime += DeltaTime;
+
+		// PerformMovement would have consumed this, hold it for the next tick so that the HMD movement is still swept
+		RestingSkippedVRInput += AdditionalVRInputVector;
+		AdditionalVRInputVector = FVector::ZeroVector;
+
+		INC_DWORD_STAT(STAT_CharRestingTicksSkipped);
+		return true;
+	}
+	else
+	{
+		RestingSkippedFrames = 0;
+	}
+
+	// Catch up on the time that was skipped so that nothing is lost, client moves carry it as a single longer move
+	DeltaTime += RestingSkippedTime;
+	RestingSkippedTime = 0.0f;
+	AdditionalVRInputVector += RestingSkippedVRInput;
+	RestingSkippedVRInput = FVector::ZeroVector;
+	return false;
+}
+
 void UVRBaseCharacterMovementComponent::StartPushBackNotification(FHitResult HitResult)
 {
 	bIsInPushBack = true;
@@ -291,6 +480,7 @@ void UVRBaseCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleL
 		FCollisionShape CapsuleShape = FCollisionShape::MakeCapsule(SweepRadius, PawnHalfHeight - ShrinkHeight);
 
 		FHitResult Hit(1.f);
+		VR_MOVEMENT_REPLAY_COUNT(FloorSweeps);
 		bBlockingHit = FloorSweepTest(Hit, CapsuleLocation, CapsuleLocation + FVector(0.f, 0.f, -TraceDist), CollisionChannel, CapsuleShape, QueryParams, ResponseParam);
 
 		if (bBlockingHit)
@@ -309,6 +499,7 @@ void UVRBaseCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleL
 					CapsuleShape.Capsule.HalfHeight = FMath::Max(PawnHalfHeight - ShrinkHeight, CapsuleShape.Capsule.Radius);
 					Hit.Reset(1.f, false);
 
+					VR_MOVEMENT_REPLAY_COUNT(FloorSweeps);
 					bBlockingHit = FloorSweepTest(Hit, CapsuleLocation, CapsuleLocation + FVector(0.f, 0.f, -TraceDist), CollisionChannel, CapsuleShape, QueryParams, ResponseParam);
 				}
 			}
@@ -1087,6 +1278,58 @@ void FSavedMove_VRBaseCharacter::SetInitialPosition(ACharacter* C)
 	FSavedMove_Character::SetInitialPosition(C);
 }
 
+bool FSavedMove_VRBaseCharacter::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* Character, float MaxDelta) const
+{
+	FSavedMove_VRBaseCharacter * nMove = (FSavedMove_VRBaseCharacter *)NewMove.Get();
+	UVRBaseCharacterMovementComponent * BaseCharMove = Character ? Cast<UVRBaseCharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+
+	if (!nMove || !BaseCharMove)
+		return false;
+
+	// The combined move can carry our movement mode change as long as the new move isn't requesting a different one
+	if (VRReplicatedMovementMode != nMove->VRReplicatedMovementMode && nMove->VRReplicatedMovementMode != EVRConjoinedMovementModes::C_MOVE_MAX)
+		return false;
+
+	// The new moves actions are still on the movement component at this point, they are only copied to the move in PostUpdate
+	if (BaseCharMove->MoveActionArray.MoveActions.Num() > 0 || nMove->ConditionalValues.MoveActionArray.MoveActions.Num() > 0)
+		return false;
+
+	// Our actions get run again from our start position, only allow the built in ones as they set absolute values.
+	// Custom actions call out to the character and may not be safe to run twice.
+	for (const FVRMoveActionContainer & MoveAction : ConditionalValues.MoveActionArray.MoveActions)
+	{
+		switch (MoveAction.MoveAction)
+		{
+		case EVRMoveAction::VRMOVEACTION_None:
+		case EVRMoveAction::VRMOVEACTION_SnapTurn:
+		case EVRMoveAction::VRMOVEACTION_Teleport:
+		case EVRMoveAction::VRMOVEACTION_StopAllMovement:
+		case EVRMoveAction::VRMOVEACTION_SetRotation:
+			break;
+		default:
+			return false;
+		}
+	}
+
+	if (!ConditionalValues.RequestedVelocity.IsZero() || !nMove->ConditionalValues.RequestedVelocity.IsZero())
+		return false;
+
+	// Hate this but we really can't combine if I am sending a new capsule height
+	if (!FMath::IsNearlyEqual(LFDiff.Z, nMove->LFDiff.Z))
+		return false;
+
+	// The summed offsets get applied as a single sweep, keep them small enough that it takes the same path as the separate ones would
+	const float MaxCombinedDeltaSq = FMath::Square(VRBaseCharacterMovementComponentStatics::MaxCombinedVRInputDelta);
+
+	if (FVector(LFDiff.X + nMove->LFDiff.X, LFDiff.Y + nMove->LFDiff.Y, 0.0f).SizeSquared() > MaxCombinedDeltaSq)
+		return false;
+
+	if ((ConditionalValues.CustomVRInputVector + nMove->ConditionalValues.CustomVRInputVector).SizeSquared() > MaxCombinedDeltaSq)
+		return false;
+
+	return FSavedMove_Character::CanCombineWith(NewMove, Character, MaxDelta);
+}
+
 void FSavedMove_VRBaseCharacter::CombineWith(const FSavedMove_Character* OldMove, ACharacter* InCharacter, APlayerController* PC, const FVector& OldStartLocation)
 {
 	UCharacterMovementComponent* CharMovement = InCharacter->GetCharacterMovement();
@@ -1104,14 +1347,23 @@ void FSavedMove_VRBaseCharacter::CombineWith(const FSavedMove_Character* OldMove
 	// Combine times for both moves
 	DeltaTime += OldMove->DeltaTime;
 
-	//FSavedMove_VRBaseCharacter * BaseSavedMove = (FSavedMove_VRBaseCharacter *)NewMove.Get();
-	FSavedMove_VRBaseCharacter * BaseSavedMovePending = (FSavedMove_VRBaseCharacter *)OldMove;
+	const FSavedMove_VRBaseCharacter * BaseSavedMovePending = (const FSavedMove_VRBaseCharacter *)OldMove;
+	UVRBaseCharacterMovementComponent * BaseCharMove = Cast<UVRBaseCharacterMovementComponent>(CharMovement);
 
-	if (/*BaseSavedMove && */BaseSavedMovePending)
+	// SetInitialPosition() is called again after this and re-reads the VR values from the movement component,
+	// so fold the pending moves values in there. That way both the local re-simulation and the values sent to the server cover both moves.
+	if (BaseSavedMovePending && BaseCharMove)
 	{
-		LFDiff.X += BaseSavedMovePending->LFDiff.X;
-		LFDiff.Y += BaseSavedMovePending->LFDiff.Y;
-	}
+		BaseCharMove->AdditionalVRInputVector += FVector(BaseSavedMovePending->LFDiff.X, BaseSavedMovePending->LFDiff.Y, 0.0f);
+		BaseCharMove->CustomVRInputVector += BaseSavedMovePending->ConditionalValues.CustomVRInputVector;
+
+		// Movement mode changes and move actions are applied at the start of the move, CanCombineWith() made sure that the new move has neither
+		if (BaseSavedMovePending->VRReplicatedMovementMode != EVRConjoinedMovementModes::C_MOVE_MAX)
+			BaseCharMove->VRReplicatedMovementMode = BaseSavedMovePending->VRReplicatedMovementMode;
+
+		if (BaseSavedMovePending->ConditionalValues.MoveActionArray.MoveActions.Num() > 0)
+			BaseCharMove->MoveActionArray = BaseSavedMovePending->ConditionalValues.MoveActionArray;
+	}
 
 	// Roll back jump force counters. SetInitialPosition() below will copy them to the saved move.
 	// Changes in certain counters like JumpCurrentCount don't allow move combining, so no need to roll those back (they are the same).
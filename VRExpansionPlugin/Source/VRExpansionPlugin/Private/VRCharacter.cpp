@@ -398,4 +398,10 @@ void AVRCharacter::ClientAdjustPositionVR_Implementation(float TimeStamp, FVecto
 void AVRCharacter::ClientVeryShortAdjustPositionVR_Implementation(float TimeStamp, FVector NewLoc, uint16 NewYaw, UPrimitiveComponent* NewBase, FName NewBaseBoneName, bool bHasBase, bool bBaseRelativePosition, uint8 ServerMovementMode)
 {
 	((UVRCharacterMovementComponent*)GetCharacterMovement())->ClientVeryShortAdjustPositionVR_Implementation(TimeStamp, NewLoc, NewYaw, NewBase, NewBaseBoneName, bHasBase, bBaseRelativePosition, ServerMovementMode);
+}
+
+// ClientCompactAdjustPosition
+void AVRCharacter::ClientCompactAdjustPositionVR_Implementation(float TimeStamp, FVRCompactClientAdjustment Adjustment, uint8 ServerMovementMode)
+{
+	((UVRCharacterMovementComponent*)GetCharacterMovement())->ClientCompactAdjustPositionVR_Implementation(TimeStamp, Adjustment, ServerMovementMode);
 }
\ No newline at end of file
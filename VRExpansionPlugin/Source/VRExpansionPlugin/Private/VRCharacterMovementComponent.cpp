@@ -10,12 +10,14 @@
 #include "GameFramework/GameNetworkManager.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/GameState.h"
+#include "GameFramework/PlayerState.h"
 #include "Components/PrimitiveComponent.h"
 #include "Animation/AnimMontage.h"
 #include "DrawDebugHelpers.h"
 //#include "PhysicsEngine/DestructibleActor.h"
 #include "VRCharacter.h"
 #include "VRExpansionFunctionLibrary.h"
+#include "Misc/VRMovementReplay.h"
 
 // @todo this is here only due to circular dependency to AIModule. To be removed
 #include "Navigation/PathFollowingComponent.h"
@@ -26,6 +28,7 @@
 
 #include "Engine/DemoNetDriver.h"
 #include "Engine/NetworkObjectList.h"
+#include "Serialization/BitWriter.h"
 
 //#include "PerfCountersHelpers.h"
 
@@ -36,6 +39,13 @@ DEFINE_LOG_CATEGORY(LogVRCharacterMovement);
  */
 DECLARE_CYCLE_STAT(TEXT("Char StepUp"), STAT_CharStepUp, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char FindFloor"), STAT_CharFindFloor, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Char FloorCache Hits"), STAT_CharFloorCacheHits, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Char FloorCache Misses"), STAT_CharFloorCacheMisses, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Char Client Adjustments Sent"), STAT_CharClientAdjustmentsSent, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Char Client Adjustments Compact"), STAT_CharClientAdjustmentsCompact, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Char Client Adjustments Suppressed"), STAT_CharClientAdjustmentsSuppressed, STATGROUP_Character);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Char Client Adjustments Per Second"), STAT_CharClientAdjustmentsPerSecond, STATGROUP_Character);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Char Client Adjustment Bytes Per Second"), STAT_CharClientAdjustmentBytesPerSecond, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char ReplicateMoveToServer"), STAT_CharacterMovementReplicateMoveToServer, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char CallServerMove"), STAT_CharacterMovementCallServerMove, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char CombineNetMove"), STAT_CharacterMovementCombineNetMove, STATGROUP_Character);
@@ -73,6 +83,87 @@ namespace CharacterMovementComponentStatics
 		TEXT("Rotation is replicated at 2 decimal precision, so values less than 0.01 won't matter."),
 		ECVF_Default);
 
+	static int32 SavedMovePoolPrewarm = 32;
+	FAutoConsoleVariableRef CVarSavedMovePoolPrewarm(
+		TEXT("vre.SavedMovePoolPrewarm"),
+		SavedMovePoolPrewarm,
+		TEXT("Number of saved moves allocated when a VR characters client prediction data is created, capped at MaxFreeMoveCount.\n")
+		TEXT("0: Allocate moves as they are first needed"),
+		ECVF_Default);
+
+	static int32 bUseFloorCache = 1;
+	FAutoConsoleVariableRef CVarUseFloorCache(
+		TEXT("vre.FloorCache"),
+		bUseFloorCache,
+		TEXT("When on, VR characters re-use their last floor sweep while the capsule only drifts slightly over a flat static floor.\n")
+		TEXT("0: Always sweep for the floor"),
+		ECVF_Default);
+
+	static float FloorCacheMaxDrift = 2.0f;
+	FAutoConsoleVariableRef CVarFloorCacheMaxDrift(
+		TEXT("vre.FloorCacheMaxDrift"),
+		FloorCacheMaxDrift,
+		TEXT("Lateral distance (uu) from the last floor sweep that the cached floor is still considered valid within."),
+		ECVF_Default);
+
+	static float FloorCacheMaxAge = 0.25f;
+	FAutoConsoleVariableRef CVarFloorCacheMaxAge(
+		TEXT("vre.FloorCacheMaxAge"),
+		FloorCacheMaxAge,
+		TEXT("Seconds that a cached floor is re-used before sweeping again regardless of movement."),
+		ECVF_Default);
+
+	static int32 bUseCompactClientAdjustments = 1;
+	FAutoConsoleVariableRef CVarUseCompactClientAdjustments(
+		TEXT("vre.CompactClientAdjustments"),
+		bUseCompactClientAdjustments,
+		TEXT("When on, client corrections are sent as a packed delta from the location the client sent for the move when the movement base matches.\n")
+		TEXT("0: Always send the full absolute correction"),
+		ECVF_Default);
+
+	static float ClientAdjustmentInFlightMaxTime = 0.5f;
+	FAutoConsoleVariableRef CVarClientAdjustmentInFlightMaxTime(
+		TEXT("vre.ClientAdjustmentInFlightMaxTime"),
+		ClientAdjustmentInFlightMaxTime,
+		TEXT("Max seconds that further corrections are held back for while the last one is still on its way to the client (uses the players ping up to this value).\n")
+		TEXT("0: Send a correction for every move that is in error"),
+		ECVF_Default);
+
+	// Deltas larger than this are sent as a full correction, keeps them well inside of the packed vectors range
+	static const float CompactAdjustmentMaxDelta = 100000.0f;
+
+#if STATS
+	// Rough size of the fixed parameters of the full corrections (timestamp, location, yaw, velocity, flags, movement mode), base and bone are not counted
+	static const uint32 FullAdjustmentBits = 32 + 96 + 16 + 96 + 2 + 8;
+	static const uint32 VeryShortAdjustmentBits = FullAdjustmentBits - 96;
+
+	// Server wide totals for the current second, published to the per second stats when it rolls over
+	static double ClientAdjustmentWindowStart = 0.0;
+	static uint32 ClientAdjustmentWindowCount = 0;
+	static uint32 ClientAdjustmentWindowBits = 0;
+
+	static void TrackClientAdjustment(uint32 NumAdjustments, uint32 NumBits)
+	{
+		ClientAdjustmentWindowCount += NumAdjustments;
+		ClientAdjustmentWindowBits += NumBits;
+
+		const double CurrentTime = FPlatformTime::Seconds();
+		if (CurrentTime - ClientAdjustmentWindowStart >= 1.0)
+		{
+			SET_DWORD_STAT(STAT_CharClientAdjustmentsPerSecond, ClientAdjustmentWindowCount);
+			SET_DWORD_STAT(STAT_CharClientAdjustmentBytesPerSecond, (ClientAdjustmentWindowBits + 7) / 8);
+			ClientAdjustmentWindowStart = CurrentTime;
+			ClientAdjustmentWindowCount = 0;
+			ClientAdjustmentWindowBits = 0;
+		}
+	}
+#endif
+
+	// Matches the rounding of SerializePackedVector at the given scale
+	FORCEINLINE FVector QuantizeVector(const FVector & Vector, float Scale)
+	{
+		return FVector(FMath::RoundToFloat(Vector.X * Scale) / Scale, FMath::RoundToFloat(Vector.Y * Scale) / Scale, FMath::RoundToFloat(Vector.Z * Scale) / Scale);
+	}
 }
 
 void UVRCharacterMovementComponent::Crouch(bool bClientSimulation)
@@ -343,6 +434,19 @@ void UVRCharacterMovementComponent::UnCrouch(bool bClientSimulation)
 	}
 }
 
+FNetworkPredictionData_Client_VRCharacter::FNetworkPredictionData_Client_VRCharacter(const UCharacterMovementComponent& ClientMovement)
+	: FNetworkPredictionData_Client_Character(ClientMovement)
+{
+	// The base class already recycles moves through FreeMoves, fill it now instead of allocating during the first moves of play
+	const int32 PrewarmCount = FMath::Min(CharacterMovementComponentStatics::SavedMovePoolPrewarm, MaxFreeMoveCount);
+	FreeMoves.Reserve(MaxFreeMoveCount);
+
+	for (int32 i = 0; i < PrewarmCount; ++i)
+	{
+		FreeMoves.Push(AllocateNewMove());
+	}
+}
+
 FNetworkPredictionData_Client* UVRCharacterMovementComponent::GetPredictionData_Client() const
 {
 	// Should only be called on client or listen server (for remote clients) in network games
@@ -386,7 +490,9 @@ void FSavedMove_VRCharacter::SetInitialPosition(ACharacter* C)
 		{
 			VRCapsuleLocation = VRC->VRRootReference->curCameraLoc;
 			VRCapsuleRotation = UVRExpansionFunctionLibrary::GetHMDPureYaw_I(VRC->VRRootReference->curCameraRot);
-			LFDiff = VRC->VRRootReference->DifferenceFromLastFrame;
+
+			// The movement component copies the root difference at tick, and also holds a pending moves difference when moves are combined
+			LFDiff = CharMove ? CharMove->AdditionalVRInputVector : VRC->VRRootReference->DifferenceFromLastFrame;
 		}
 		else
 		{
@@ -567,6 +673,34 @@ void UVRCharacterMovementComponent::ServerMoveVRExLight_Implementation(
 	ServerMoveVR_Implementation(TimeStamp, FVector::ZeroVector, ClientLoc, CapsuleLoc, ConditionalReps, LFDiff, CapsuleYaw, MoveFlags, MoveReps, ClientMovementMode);
 }
 
+void UVRCharacterMovementComponent::ServerMoveOld_Implementation(float OldTimeStamp, FVector_NetQuantize10 OldAccel, uint8 OldMoveFlags)
+{
+	if (FVRServerMoveQueue::ShouldQueueMoves(this))
+	{
+		if (FVRServerMoveQueue::IsEnabled())
+		{
+			FVRServerMoveQueue::Get().SubmitMove(this, [=]()
+			{
+				Super::ServerMoveOld_Implementation(OldTimeStamp, OldAccel, OldMoveFlags);
+			});
+			return;
+		}
+
+		// Budget was turned off, older moves still waiting have to run first
+		FVRServerMoveQueue::Get().DrainMoves(this);
+	}
+
+	Super::ServerMoveOld_Implementation(OldTimeStamp, OldAccel, OldMoveFlags);
+}
+
+void UVRCharacterMovementComponent::GetServerMoveQueueStats(int32 & QueueDepth, int32 & MaxQueueDepth, float & AverageLatencyMs, float & MaxLatencyMs) const
+{
+	QueueDepth = ServerMoveQueueState.Moves.Num();
+	MaxQueueDepth = ServerMoveQueueState.MaxDepth;
+	AverageLatencyMs = ServerMoveQueueState.NumProcessed ? (float)(ServerMoveQueueState.TotalLatency / ServerMoveQueueState.NumProcessed) * 1000.0f : 0.0f;
+	MaxLatencyMs = (float)ServerMoveQueueState.MaxLatency * 1000.0f;
+}
+
 void UVRCharacterMovementComponent::ServerMoveVR_Implementation(
 	float TimeStamp,
 	FVector_NetQuantize10 InAccel,
@@ -584,6 +718,25 @@ void UVRCharacterMovementComponent::ServerMoveVR_Implementation(
 		return;
 	}
 
+	// Over the servers move budget, the queue calls back in here when the move gets its turn
+	if (FVRServerMoveQueue::ShouldQueueMoves(this))
+	{
+		if (FVRServerMoveQueue::IsEnabled())
+		{
+			// The base could be destroyed before the move runs
+			TWeakObjectPtr<UPrimitiveComponent> ClientMovementBase = MoveReps.ClientMovementBase;
+			FVRServerMoveQueue::Get().SubmitMove(this, [=]() mutable
+			{
+				MoveReps.ClientMovementBase = ClientMovementBase.Get();
+				ServerMoveVR_Implementation(TimeStamp, InAccel, ClientLoc, CapsuleLoc, ConditionalReps, LFDiff, CapsuleYaw, MoveFlags, MoveReps, ClientMovementMode);
+			});
+			return;
+		}
+
+		// Budget was turned off, older moves still waiting have to run first
+		FVRServerMoveQueue::Get().DrainMoves(this);
+	}
+
 	FNetworkPredictionData_Server_Character* ServerData = GetPredictionData_Server_Character();
 	check(ServerData);
 
@@ -730,6 +883,20 @@ void UVRCharacterMovementComponent::CallServerMove
 	const FSavedMove_VRCharacter * OldMove = (const FSavedMove_VRCharacter *)OldCMove;
 
 	check(NewMove != nullptr);
+
+	if (ActiveMovementRecording.IsValid())
+	{
+		// Record in the order that the server will process them, old moves are resends and are skipped
+		AVRCharacter * VRChar = Cast<AVRCharacter>(CharacterOwner);
+		FNetworkPredictionData_Client_Character* RecordClientData = GetPredictionData_Client_Character();
+		if (RecordClientData && RecordClientData->PendingMove.IsValid())
+		{
+			ActiveMovementRecording->RecordMove(*(const FSavedMove_VRCharacter *)RecordClientData->PendingMove.Get(), VRChar);
+		}
+
+		ActiveMovementRecording->RecordMove(*NewMove, VRChar);
+	}
+
 	//uint32 ClientYawPitchINT = PackYawAndPitchTo32(NewMove->SavedControlRotation.Yaw, NewMove->SavedControlRotation.Pitch);
 	//uint8 ClientRollBYTE = FRotator::CompressAxisToByte(NewMove->SavedControlRotation.Roll);
 	const uint16 CapsuleYawShort = FRotator::CompressAxisToShort(NewMove->VRCapsuleRotation.Yaw);
@@ -1311,7 +1478,6 @@ void UVRCharacterMovementComponent::ReplicateMoveToServer(float DeltaTime, const
 	}
 
 	NewMove->SetMoveFor(CharacterOwner, DeltaTime, NewAcceleration, *ClientData);
-	// Causing really bad crash when using vr offset location, rather remove for now than have it merge move improperly.
 
 	// see if the two moves could be combined
 	// do not combine moves which have different TimeStamps (before and after reset).
@@ -1456,15 +1622,27 @@ UVRCharacterMovementComponent::UVRCharacterMovementComponent(const FObjectInitia
 	bUseClientControlRotation = false;
 	bAllowMovementMerging = false;
 	bRequestedMoveUseAcceleration = false;
+
+	PendingAdjustmentClientLocation = FVector::ZeroVector;
+	PendingAdjustmentClientBase = nullptr;
+	PendingAdjustmentClientBoneName = NAME_None;
+	LastCompactAdjustmentVelocity = FVector::ZeroVector;
+	LastCompactAdjustmentVelocityId = 0;
 }
 
 
 void UVRCharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
-	if (!HasValidData())
-	{
-		return;
-	}
+	if (!HasValidData())
+	{
+		return;
+	}
+
+	// Whichever character ticks first runs the queued moves for everyone, with the budget set to 0 it runs all of them
+	if (CharacterOwner && CharacterOwner->Role == ROLE_Authority)
+	{
+		FVRServerMoveQueue::Get().ProcessWorld(GetWorld());
+	}
 
 	if (CharacterOwner && CharacterOwner->IsLocallyControlled())
 	{
@@ -1632,6 +1810,11 @@ bool UVRCharacterMovementComponent::SafeMoveUpdatedComponent(const FVector& Delt
 		return false;
 	}
 
+	if (bSweep)
+	{
+		VR_MOVEMENT_REPLAY_COUNT(MoveSweeps);
+	}
+
 	bool bMoveResult = MoveUpdatedComponent(Delta, NewRotation, bSweep, &OutHit, Teleport);
 
 	// Handle initial penetrations
@@ -2354,6 +2537,81 @@ FVector UVRCharacterMovementComponent::GetImpartedMovementBaseVelocity() const
 
 
 
+bool UVRCharacterMovementComponent::GetCachedFloor(const FVector& CapsuleLocation, FFindFloorResult& OutFloorResult) const
+{
+	if (!CachedFloor.bIsValid)
+		return false;
+
+	if (!CharacterMovementComponentStatics::bUseFloorCache || !IsMovingOnGround())
+	{
+		CachedFloor.bIsValid = false;
+		return false;
+	}
+
+	UPrimitiveComponent * FloorComponent = CachedFloor.FloorResult.HitResult.Component.Get();
+	const FVector Offset = CapsuleLocation - CachedFloor.CapsuleLocation;
+
+	// Anything changing about the floor, our base or our capsule drops the cache
+	if (!FloorComponent || FloorComponent != CharacterOwner->GetMovementBase() ||
+		FloorComponent->Mobility != EComponentMobility::Static ||
+		!FloorComponent->IsQueryCollisionEnabled() ||
+		FloorComponent->GetCollisionResponseToChannel(UpdatedComponent->GetCollisionObjectType()) != ECR_Block ||
+		!FMath::IsNearlyEqual(CachedFloor.CapsuleRadius, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius()) ||
+		!FMath::IsNearlyEqual(CachedFloor.CapsuleHalfHeight, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight()) ||
+		!FMath::IsNearlyEqual(Offset.Z, 0.0f, 0.01f) ||
+		Offset.SizeSquared2D() > FMath::Square(CharacterMovementComponentStatics::FloorCacheMaxDrift) ||
+		(GetWorld()->GetTimeSeconds() - CachedFloor.CacheTime) > CharacterMovementComponentStatics::FloorCacheMaxAge)
+	{
+		CachedFloor.bIsValid = false;
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_CharFloorCacheHits);
+
+	// Flat floor, so the hit just slides along with us
+	const FVector LateralOffset(Offset.X, Offset.Y, 0.0f);
+	OutFloorResult = CachedFloor.FloorResult;
+	OutFloorResult.HitResult.Location += LateralOffset;
+	OutFloorResult.HitResult.ImpactPoint += LateralOffset;
+	OutFloorResult.HitResult.TraceStart += LateralOffset;
+	OutFloorResult.HitResult.TraceEnd += LateralOffset;
+
+	return true;
+}
+
+void UVRCharacterMovementComponent::UpdateFloorCache(const FVector& CapsuleLocation, const FFindFloorResult& FloorResult) const
+{
+	CachedFloor.bIsValid = false;
+
+	if (!CharacterMovementComponentStatics::bUseFloorCache || !IsMovingOnGround())
+		return;
+
+	INC_DWORD_STAT(STAT_CharFloorCacheMisses);
+
+	// Only flat static floors that we are solidly standing on, anything that would need perching, penetration handling or might move is swept every time
+	// Hits near the capsule edge could be a ledge that we drift off of while the cache is in use, so those are also swept regardless of the perch settings
+	UPrimitiveComponent * FloorComponent = FloorResult.HitResult.Component.Get();
+	const float CapsuleRadius = CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	if (!FloorComponent || !FloorResult.IsWalkableFloor() || FloorResult.bLineTrace || FloorResult.FloorDist <= 0.0f ||
+		FloorResult.HitResult.bStartPenetrating ||
+		FloorResult.HitResult.ImpactNormal.Z < (1.0f - KINDA_SMALL_NUMBER) ||
+		!IsWithinEdgeTolerance(CapsuleLocation, FloorResult.HitResult.ImpactPoint, CapsuleRadius - CharacterMovementComponentStatics::FloorCacheMaxDrift) ||
+		FloorComponent->Mobility != EComponentMobility::Static ||
+		FloorComponent->IsSimulatingPhysics() ||
+		MovementBaseUtility::IsDynamicBase(FloorComponent) ||
+		ShouldComputePerchResult(FloorResult.HitResult, true))
+	{
+		return;
+	}
+
+	CachedFloor.FloorResult = FloorResult;
+	CachedFloor.CapsuleLocation = CapsuleLocation;
+	CachedFloor.CapsuleRadius = CapsuleRadius;
+	CachedFloor.CapsuleHalfHeight = CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	CachedFloor.CacheTime = GetWorld()->GetTimeSeconds();
+	CachedFloor.bIsValid = true;
+}
+
 void UVRCharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FFindFloorResult& OutFloorResult, bool bZeroDelta, const FHitResult* DownwardSweepResult) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_CharFindFloor);
@@ -2389,8 +2647,19 @@ void UVRCharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FF
 
 		if (bAlwaysCheckFloor || !bZeroDelta || bForceNextFloorCheck || bJustTeleported)
 		{
+			// HMD movement alone makes the delta non zero, so most of our floor checks land here
+			const bool bCanUseFloorCache = !bAlwaysCheckFloor && !bForceNextFloorCheck && !bJustTeleported && DownwardSweepResult == nullptr;
 			MutableThis->bForceNextFloorCheck = false;
-			ComputeFloorDist(UseCapsuleLocation, FloorLineTraceDist, FloorSweepTraceDist, OutFloorResult, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius(), DownwardSweepResult);
+
+			if (bCanUseFloorCache && GetCachedFloor(UseCapsuleLocation, OutFloorResult))
+			{
+				bNeedToValidateFloor = false;
+			}
+			else
+			{
+				ComputeFloorDist(UseCapsuleLocation, FloorLineTraceDist, FloorSweepTraceDist, OutFloorResult, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius(), DownwardSweepResult);
+				UpdateFloorCache(UseCapsuleLocation, OutFloorResult);
+			}
 		}
 		else
 		{
@@ -3835,11 +4104,23 @@ void UVRCharacterMovementComponent::SendClientAdjustment()
 			FMath::Min(NetworkMinTimeBetweenClientAdjustmentsLargeCorrection, NetworkMinTimeBetweenClientAdjustments) :
 			FMath::Max(NetworkMinTimeBetweenClientAdjustmentsLargeCorrection, NetworkMinTimeBetweenClientAdjustments);
 
+		// The client made this move before it could have received the last correction, correcting it again would only repeat that one
+		if (!ServerData->bForceClientUpdate && IsClientAdjustmentInFlight(CurrentTime))
+		{
+			INC_DWORD_STAT(STAT_CharClientAdjustmentsSuppressed);
+		}
 		// Check if correction is throttled based on time limit between updates.
-		if (CurrentTime - ServerLastClientAdjustmentTime > AdjustmentTimeThreshold)
+		else if (CurrentTime - ServerLastClientAdjustmentTime > AdjustmentTimeThreshold)
 		{
 			ServerLastClientAdjustmentTime = CurrentTime;
+			INC_DWORD_STAT(STAT_CharClientAdjustmentsSent);
+
+#if STATS
+			// Root motion corrections are counted but not sized
+			uint32 AdjustmentBits = 0;
+#endif
 
+			FVRCompactClientAdjustment CompactAdjustment;
 			const bool bIsPlayingNetworkedRootMotionMontage = CharacterOwner->IsPlayingNetworkedRootMotionMontage();
 			if (HasRootMotionSources())
 			{
@@ -3879,8 +4160,29 @@ void UVRCharacterMovementComponent::SendClientAdjustment()
 					PackNetworkMovementMode()
 				);
 			}
+			else if (BuildCompactClientAdjustment(*ServerData, CompactAdjustment))
+			{
+				ClientCompactAdjustPositionVR
+				(
+					ServerData->PendingAdjustment.TimeStamp,
+					CompactAdjustment,
+					PackNetworkMovementMode()
+				);
+
+				INC_DWORD_STAT(STAT_CharClientAdjustmentsCompact);
+
+#if STATS
+				FBitWriter SizeWriter(256, true);
+				bool bSizeSuccess = false;
+				CompactAdjustment.NetSerialize(SizeWriter, nullptr, bSizeSuccess);
+				AdjustmentBits = 32 + 8 + SizeWriter.GetNumBits();
+#endif
+			}
 			else if (ServerData->PendingAdjustment.NewVel.IsZero())
 			{
+#if STATS
+				AdjustmentBits = CharacterMovementComponentStatics::VeryShortAdjustmentBits;
+#endif
 				ClientVeryShortAdjustPositionVR
 				(
 					ServerData->PendingAdjustment.TimeStamp,
@@ -3895,6 +4197,9 @@ void UVRCharacterMovementComponent::SendClientAdjustment()
 			}
 			else
 			{
+#if STATS
+				AdjustmentBits = CharacterMovementComponentStatics::FullAdjustmentBits;
+#endif
 				ClientAdjustPositionVR
 				(
 					ServerData->PendingAdjustment.TimeStamp,
@@ -3908,6 +4213,10 @@ void UVRCharacterMovementComponent::SendClientAdjustment()
 					PackNetworkMovementMode()
 				);
 			}
+
+#if STATS
+			CharacterMovementComponentStatics::TrackClientAdjustment(1, AdjustmentBits);
+#endif
 		}
 	}
 
@@ -3916,6 +4225,145 @@ void UVRCharacterMovementComponent::SendClientAdjustment()
 	ServerData->bForceClientUpdate = false;
 }
 
+bool UVRCharacterMovementComponent::IsClientAdjustmentInFlight(float CurrentTime) const
+{
+	if (CharacterMovementComponentStatics::ClientAdjustmentInFlightMaxTime <= 0.0f || ServerLastClientAdjustmentTime <= 0.0f)
+		return false;
+
+	float RoundTripTime = CharacterMovementComponentStatics::ClientAdjustmentInFlightMaxTime;
+	if (CharacterOwner && CharacterOwner->PlayerState)
+	{
+		// ExactPing is in milliseconds
+		RoundTripTime = FMath::Min(RoundTripTime, CharacterOwner->PlayerState->ExactPing * 0.001f);
+	}
+
+	return (CurrentTime - ServerLastClientAdjustmentTime) < RoundTripTime;
+}
+
+bool UVRCharacterMovementComponent::BuildCompactClientAdjustment(const FNetworkPredictionData_Server_Character & ServerData, FVRCompactClientAdjustment & OutAdjustment)
+{
+	if (!CharacterMovementComponentStatics::bUseCompactClientAdjustments || ServerData.bForceClientUpdate)
+		return false;
+
+	const FClientAdjustment & Adjustment = ServerData.PendingAdjustment;
+
+	// The client takes the base from its own move, so a dynamic base has to be the one it sent us.
+	// Non dynamic bases are never sent by the client, it only needs to know if we have one at all.
+	if (MovementBaseUtility::UseRelativeLocation(Adjustment.NewBase))
+	{
+		if (Adjustment.NewBase != PendingAdjustmentClientBase || Adjustment.NewBaseBoneName != PendingAdjustmentClientBoneName)
+			return false;
+	}
+	else if (PendingAdjustmentClientBase != nullptr)
+	{
+		return false;
+	}
+
+	// Both are relative to the same base if one is
+	const FVector LocationDelta = Adjustment.NewLoc - PendingAdjustmentClientLocation;
+	if (LocationDelta.ContainsNaN() || LocationDelta.GetAbsMax() > CharacterMovementComponentStatics::CompactAdjustmentMaxDelta)
+		return false;
+
+	OutAdjustment.LocationDelta = LocationDelta;
+	OutAdjustment.Yaw = FRotator::CompressAxisToShort(Adjustment.NewRot.Yaw);
+	OutAdjustment.bHasBase = Adjustment.NewBase != nullptr;
+
+	if (Adjustment.NewVel.IsZero())
+	{
+		OutAdjustment.VelocityMode = EVRCompactAdjustmentVelocity::Zero;
+	}
+	else
+	{
+		// Compare at the precision it is sent at so that the clients copy matches ours
+		const FVector QuantizedVelocity = CharacterMovementComponentStatics::QuantizeVector(Adjustment.NewVel, 10.0f);
+
+		if (LastCompactAdjustmentVelocityId != 0 && QuantizedVelocity == LastCompactAdjustmentVelocity)
+		{
+			OutAdjustment.VelocityMode = EVRCompactAdjustmentVelocity::Unchanged;
+		}
+		else
+		{
+			// Zero is reserved for no velocity having been sent yet
+			LastCompactAdjustmentVelocityId = (LastCompactAdjustmentVelocityId % 255) + 1;
+			LastCompactAdjustmentVelocity = QuantizedVelocity;
+
+			OutAdjustment.VelocityMode = EVRCompactAdjustmentVelocity::Sent;
+			OutAdjustment.Velocity = QuantizedVelocity;
+		}
+
+		OutAdjustment.VelocityId = LastCompactAdjustmentVelocityId;
+	}
+
+	return true;
+}
+
+void UVRCharacterMovementComponent::ClientCompactAdjustPositionVR(float TimeStamp, const FVRCompactClientAdjustment & Adjustment, uint8 ServerMovementMode)
+{
+	((AVRCharacter*)CharacterOwner)->ClientCompactAdjustPositionVR(TimeStamp, Adjustment, ServerMovementMode);
+}
+
+void UVRCharacterMovementComponent::ClientCompactAdjustPositionVR_Implementation(float TimeStamp, const FVRCompactClientAdjustment & Adjustment, uint8 ServerMovementMode)
+{
+	if (!HasValidData() || !IsActive())
+	{
+		return;
+	}
+
+	FNetworkPredictionData_Client_Character* ClientData = GetPredictionData_Client_Character();
+	check(ClientData);
+
+	// The delta is from the move we sent, without it there is nothing to apply it to
+	int32 MoveIndex = ClientData->GetSavedMoveIndex(TimeStamp);
+	if (MoveIndex == INDEX_NONE)
+	{
+		if (ClientData->LastAckedMove.IsValid())
+		{
+			UE_LOG(LogNetPlayerMovement, Log, TEXT("ClientCompactAdjustPositionVR_Implementation could not find Move for TimeStamp: %f, LastAckedTimeStamp: %f, CurrentTimeStamp: %f"), TimeStamp, ClientData->LastAckedMove->TimeStamp, ClientData->CurrentTimeStamp);
+		}
+		return;
+	}
+
+	const FSavedMovePtr & CorrectedMove = ClientData->SavedMoves[MoveIndex];
+	UPrimitiveComponent * MoveBase = CorrectedMove->EndBase.Get();
+	const FName MoveBoneName = CorrectedMove->EndBoneName;
+	const bool bBaseRelativePosition = MovementBaseUtility::UseRelativeLocation(MoveBase);
+
+	// Rebuild the location the same way that the server received it in CallServerMove
+	const FVector SentLocation = bBaseRelativePosition ? CorrectedMove->SavedRelativeLocation : CorrectedMove->SavedLocation;
+	const FVector NewLocation = CharacterMovementComponentStatics::QuantizeVector(SentLocation, 100.0f) + Adjustment.LocationDelta;
+
+	FVector NewVelocity = FVector::ZeroVector;
+	switch (Adjustment.VelocityMode)
+	{
+	case EVRCompactAdjustmentVelocity::Sent:
+	{
+		NewVelocity = Adjustment.Velocity;
+		LastCompactAdjustmentVelocity = Adjustment.Velocity;
+		LastCompactAdjustmentVelocityId = Adjustment.VelocityId;
+	}break;
+	case EVRCompactAdjustmentVelocity::Unchanged:
+	{
+		// If the correction that sent it was lost then our own velocity for the move is the best we have
+		NewVelocity = (Adjustment.VelocityId == LastCompactAdjustmentVelocityId) ? LastCompactAdjustmentVelocity : CorrectedMove->SavedVelocity;
+	}break;
+	case EVRCompactAdjustmentVelocity::Zero:
+	default: break;
+	}
+
+	ClientAdjustPositionVR_Implementation
+	(
+		TimeStamp,
+		NewLocation,
+		Adjustment.Yaw,
+		NewVelocity,
+		Adjustment.bHasBase ? MoveBase : nullptr,
+		Adjustment.bHasBase ? MoveBoneName : NAME_None,
+		Adjustment.bHasBase,
+		bBaseRelativePosition,
+		ServerMovementMode
+	);
+}
+
 
 void UVRCharacterMovementComponent::ClientVeryShortAdjustPositionVR(float TimeStamp, FVector NewLoc, uint16 NewYaw, UPrimitiveComponent* NewBase, FName NewBaseBoneName, bool bHasBase, bool bBaseRelativePosition, uint8 ServerMovementMode)
 {
@@ -4182,6 +4630,9 @@ void UVRCharacterMovementComponent::ServerMoveHandleClientErrorVR(float ClientTi
 	if (ServerData->bForceClientUpdate || ServerCheckClientErrorVR(ClientTimeStamp, DeltaTime, Accel, ClientLoc, ClientYaw, RelativeClientLoc, ClientMovementBase, ClientBaseBoneName, ClientMovementMode))
 	{
 		UPrimitiveComponent* MovementBase = CharacterOwner->GetMovementBase();
+		PendingAdjustmentClientLocation = RelativeClientLoc;
+		PendingAdjustmentClientBase = ClientMovementBase;
+		PendingAdjustmentClientBoneName = ClientBaseBoneName;
 		ServerData->PendingAdjustment.NewVel = Velocity;
 		ServerData->PendingAdjustment.NewBase = MovementBase;
 		ServerData->PendingAdjustment.NewBaseBoneName = CharacterOwner->GetBasedMovement().BoneName;
@@ -4,6 +4,7 @@
 #include "Engine/Engine.h"
 #include "IXRTrackingSystem.h"
 #include "IHeadMountedDisplay.h"
+#include "Misc/VRGripSlotIndex.h"
 
 #if WITH_EDITOR
 #include "Editor/UnrealEd/Classes/Editor/EditorEngine.h"
@@ -45,40 +46,9 @@ void UVRExpansionFunctionLibrary::GetGripSlotInRangeByTypeName(FName SlotType, A
 	if (!Actor)
 		return;
 
-	MaxRange = FMath::Square(MaxRange);
-
 	if (USceneComponent *rootComp = Actor->GetRootComponent())
 	{
-		FVector RelativeWorldLocation = rootComp->GetComponentTransform().InverseTransformPosition(WorldLocation);
-		float ClosestSlotDistance = -0.1f;
-
-		TArray<FName> SocketNames = rootComp->GetAllSocketNames();
-
-		FString GripIdentifier = SlotType.ToString();
-
-		int foundIndex = 0;
-
-		for (int i = 0; i < SocketNames.Num(); ++i)
-		{
-			if (SocketNames[i].ToString().Contains(GripIdentifier, ESearchCase::IgnoreCase, ESearchDir::FromStart))
-			{
-			
-				float vecLen = FVector::DistSquared(RelativeWorldLocation, rootComp->GetSocketTransform(SocketNames[i], ERelativeTransformSpace::RTS_Component).GetLocation());
-
-				if (MaxRange >= vecLen && (ClosestSlotDistance < 0.0f || vecLen < ClosestSlotDistance))
-				{
-					ClosestSlotDistance = vecLen;
-					bHadSlotInRange = true;
-					foundIndex = i;
-				}
-			}
-		}
-
-		if (bHadSlotInRange)
-		{
-			SlotWorldTransform = rootComp->GetSocketTransform(SocketNames[foundIndex]);
-			SlotWorldTransform.SetScale3D(FVector(1.0f));
-		}
+		FVRGripSlotIndex::Get().GetGripSlotInRange(SlotType, rootComp, WorldLocation, MaxRange, bHadSlotInRange, SlotWorldTransform);
 	}
 }
 
@@ -90,37 +60,7 @@ void UVRExpansionFunctionLibrary::GetGripSlotInRangeByTypeName_Component(FName S
 	if (!Component)
 		return;
 
-	FVector RelativeWorldLocation = Component->GetComponentTransform().InverseTransformPosition(WorldLocation);
-	MaxRange = FMath::Square(MaxRange);
-
-	float ClosestSlotDistance = -0.1f;
-
-	TArray<FName> SocketNames = Component->GetAllSocketNames();
-
-	FString GripIdentifier = SlotType.ToString();
-
-	int foundIndex = 0;
-
-	for (int i = 0; i < SocketNames.Num(); ++i)
-	{
-		if (SocketNames[i].ToString().Contains(GripIdentifier, ESearchCase::IgnoreCase, ESearchDir::FromStart))
-		{
-			float vecLen = FVector::DistSquared(RelativeWorldLocation, Component->GetSocketTransform(SocketNames[i], ERelativeTransformSpace::RTS_Component).GetLocation());
-
-			if (MaxRange >= vecLen && (ClosestSlotDistance < 0.0f || vecLen < ClosestSlotDistance))
-			{
-				ClosestSlotDistance = vecLen;
-				bHadSlotInRange = true;
-				foundIndex = i;
-			}
-		}
-	}
-
-	if (bHadSlotInRange)
-	{
-		SlotWorldTransform = Component->GetSocketTransform(SocketNames[foundIndex]);
-		SlotWorldTransform.SetScale3D(FVector(1.0f));
-	}
+	FVRGripSlotIndex::Get().GetGripSlotInRange(SlotType, Component, WorldLocation, MaxRange, bHadSlotInRange, SlotWorldTransform);
 }
 
 FRotator UVRExpansionFunctionLibrary::GetHMDPureYaw(FRotator HMDRotation)
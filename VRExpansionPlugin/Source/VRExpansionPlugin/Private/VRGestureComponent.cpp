@@ -1,5 +1,6 @@
 #include "VRGestureComponent.h"
 #include "TimerManager.h"
+#include "VRGlobalSettings.h"
 
 DECLARE_CYCLE_STAT(TEXT("TickGesture ~ TickingGesture"), STAT_TickGesture, STATGROUP_TickGesture);
 
@@ -120,6 +121,11 @@ void UVRGestureComponent::BeginRecording(bool bRunDetection, bool bFlattenGestur
 	RecordingBufferSize = SampleBufferSize;
 	RecordingDelta = 1.0f / SamplingHTZ;
 	RecordingClampingTolerance = ClampingTolerance;
+
+	// Nothing to see on an optimized server, don't build the spline components or debug lines
+	if (UVRGlobalSettings::IsServerOptimized())
+		bDrawGesture = false;
+
 	bDrawRecordingGesture = bDrawGesture;
 	bDrawRecordingGestureAsSpline = bDrawAsSpline;
 	bRecordingFlattenGesture = bFlattenGesture;
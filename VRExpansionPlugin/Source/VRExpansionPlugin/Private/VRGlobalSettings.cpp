@@ -9,7 +9,8 @@ UVRGlobalSettings::UVRGlobalSettings(const FObjectInitializer& ObjectInitializer
 	CurrentControllerProfileTransformRight(FTransform::Identity),
 	OneEuroMinCutoff(2.0f),
 	OneEuroCutoffSlope(0.007f),
-	OneEuroDeltaCutoff(1.0f)
+	OneEuroDeltaCutoff(1.0f),
+	bUseDedicatedServerOptimizations(true)
 
 {
 }
\ No newline at end of file
@@ -19,6 +19,8 @@ DEFINE_LOG_CATEGORY(LogVRRootComponent);
 #define LOCTEXT_NAMESPACE "VRRootComponent"
 
 DECLARE_CYCLE_STAT(TEXT("VRRootMovement"), STAT_VRRootMovement, STATGROUP_VRRootComponent);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VR Root Relative Sweeps"), STAT_VRRootRelativeSweeps, STATGROUP_VRRootComponent);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VR Root Relative Sweeps Skipped"), STAT_VRRootRelativeSweepsSkipped, STATGROUP_VRRootComponent);
 
 typedef TArray<FOverlapInfo, TInlineAllocator<3>> TInlineOverlapInfoArray;
 
@@ -298,6 +300,14 @@ UVRRootComponent::UVRRootComponent(const FObjectInitializer& ObjectInitializer)
 	bAllowSimulatingCollision = false;
 	bUseWalkingCollisionOverride = false;
 	WalkingCollisionOverride = ECollisionChannel::ECC_Pawn;
+	WalkingCollisionMinSweepDistance = 0.0f;
+
+	NavigationUpdateMinDistance = 5.0f;
+	NavigationUpdateMinInterval = 0.1f;
+	bNavigationUpdatePending = false;
+	LastNavigationUpdateLocation = FVector::ZeroVector;
+	LastNavigationUpdateTime = 0.0f;
+	PendingRelativeMovement = FVector::ZeroVector;
 
 	bCalledUpdateTransform = false;
 
@@ -496,14 +506,8 @@ void UVRRootComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 			}
 
 			FHitResult OutHit;
-			FCollisionQueryParams Params("RelativeMovementSweep", false, GetOwner());
-			FCollisionResponseParams ResponseParam;
-
-			InitSweepCollisionParams(Params, ResponseParam);
-			Params.bFindInitialOverlaps = true;
 			bool bBlockingHit = false;
 
-
 			if (bUseWalkingCollisionOverride)
 			{
 				bool bAllowWalkingCollision = false;
@@ -514,7 +518,35 @@ void UVRRootComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 				}
 
 				if (bAllowWalkingCollision)
-					bBlockingHit = GetWorld()->SweepSingleByChannel(OutHit, LastPosition, OffsetComponentToWorld.GetLocation(), FQuat::Identity, WalkingCollisionOverride, GetCollisionShape(), Params, ResponseParam);
+				{
+					// Accumulated relative to the capsule so that the characters own movement doesn't count towards it
+					PendingRelativeMovement += OffsetComponentToWorld.GetLocation() - LastPosition;
+
+					if (WalkingCollisionMinSweepDistance <= 0.0f || PendingRelativeMovement.SizeSquared() >= FMath::Square(WalkingCollisionMinSweepDistance))
+					{
+						INC_DWORD_STAT(STAT_VRRootRelativeSweeps);
+
+						FCollisionQueryParams Params("RelativeMovementSweep", false, GetOwner());
+						FCollisionResponseParams ResponseParam;
+
+						InitSweepCollisionParams(Params, ResponseParam);
+						Params.bFindInitialOverlaps = true;
+
+						// Sweep the whole accumulated movement, the difference below then carries all of it to the movement component
+						LastPosition = OffsetComponentToWorld.GetLocation() - PendingRelativeMovement;
+						PendingRelativeMovement = FVector::ZeroVector;
+
+						bBlockingHit = GetWorld()->SweepSingleByChannel(OutHit, LastPosition, OffsetComponentToWorld.GetLocation(), FQuat::Identity, WalkingCollisionOverride, GetCollisionShape(), Params, ResponseParam);
+					}
+					else
+					{
+						INC_DWORD_STAT(STAT_VRRootRelativeSweepsSkipped);
+					}
+				}
+				else
+				{
+					PendingRelativeMovement = FVector::ZeroVector;
+				}
 
 				if (bBlockingHit && OutHit.Component.IsValid())
 				{
@@ -570,11 +602,7 @@ void UVRRootComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 			if (!CharMove || !CharMove->IsActive())
 			{
 				OnUpdateTransform(EUpdateTransformFlags::None, ETeleportType::None);
-				if (bNavigationRelevant && bRegistered)
-				{
-					UpdateNavigationData();
-					PostUpdateNavigationData();
-				}
+				bNavigationUpdatePending = true;
 			}
 			else // Let the character movement move the capsule instead
 			{
@@ -584,11 +612,7 @@ void UVRRootComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 				// This is an edge case, need to check if the nav data needs updated client side
 				if (this->GetOwner()->Role == ENetRole::ROLE_SimulatedProxy)
 				{
-					if (bNavigationRelevant && bRegistered)
-					{
-						UpdateNavigationData();
-						PostUpdateNavigationData();
-					}
+					bNavigationUpdatePending = true;
 				}
 			}
 
@@ -598,9 +622,48 @@ void UVRRootComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 		}
 	}
 
+	// Also catches updates that were held back by the interval on an earlier frame
+	if (bNavigationUpdatePending)
+		UpdateNavigationDataThrottled();
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 }
 
+void UVRRootComponent::ForceNavigationUpdate()
+{
+	bNavigationUpdatePending = true;
+	UpdateNavigationDataThrottled(true);
+}
+
+void UVRRootComponent::UpdateNavigationDataThrottled(bool bForce)
+{
+	if (!bNavigationRelevant || !bRegistered)
+	{
+		bNavigationUpdatePending = false;
+		return;
+	}
+
+	const FVector NavigationLocation = OffsetComponentToWorld.GetLocation();
+	const float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+
+	if (!bForce)
+	{
+		// Still close enough to the registered location, stays pending in case we keep moving away
+		if (NavigationUpdateMinDistance > 0.0f && FVector::DistSquared(NavigationLocation, LastNavigationUpdateLocation) < FMath::Square(NavigationUpdateMinDistance))
+			return;
+
+		if (NavigationUpdateMinInterval > 0.0f && (CurrentTime - LastNavigationUpdateTime) < NavigationUpdateMinInterval)
+			return;
+	}
+
+	bNavigationUpdatePending = false;
+	LastNavigationUpdateLocation = NavigationLocation;
+	LastNavigationUpdateTime = CurrentTime;
+
+	UpdateNavigationData();
+	PostUpdateNavigationData();
+}
+
 
 void UVRRootComponent::SendPhysicsTransform(ETeleportType Teleport)
 {
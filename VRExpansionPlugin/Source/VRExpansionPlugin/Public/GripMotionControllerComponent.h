@@ -94,6 +94,181 @@ public:
 
 };
 
+FORCEINLINE const UObject * GetIndexedGripObject(const FBPActorGripInformation & Grip) { return Grip.GrippedObject; }
+FORCEINLINE const UObject * GetIndexedGripObject(const FBPActorPhysicsHandleInformation & Grip) { return Grip.HandledObject; }
+
+/**
+* Grip ID and gripped object to slot index for one of the grip arrays, replaces the linear FindByKey searches.
+* Grips added to the end or removed through NotifyAdded / NotifyRemoved update the maps in place, any other change marks it dirty
+* and it rebuilds on the next lookup. Found slots are checked against the array and the first miss after MarkUnverified rebuilds once,
+* so key changes in place cost a rebuild rather than a wrong result. The first grip in the array wins, same as FindByKey.
+*/
+template<typename GripType>
+struct TVRGripIndex
+{
+	TMap<uint8, int32> ByGripID;
+	TMap<const UObject*, int32> ByObject;
+	int32 IndexedNum;
+	bool bDirty;
+
+	// More than one grip shares a key, removals then need a rebuild to find the next one
+	bool bHasDuplicateKeys;
+
+	// Set by a rebuild, cleared by changes the maps weren't updated for, misses only rebuild while it is clear
+	bool bVerified;
+
+	TVRGripIndex() :
+		IndexedNum(0),
+		bDirty(true),
+		bHasDuplicateKeys(false),
+		bVerified(false)
+	{}
+
+	FORCEINLINE void MarkDirty() { bDirty = true; bVerified = false; }
+
+	// Grips may have changed keys in place, found slots are still checked and the next miss rebuilds
+	FORCEINLINE void MarkUnverified() { bVerified = false; }
+
+	void Rebuild(const TArray<GripType> & Grips)
+	{
+		ByGripID.Reset();
+		ByObject.Reset();
+		bHasDuplicateKeys = false;
+
+		for (int32 i = 0; i < Grips.Num(); ++i)
+		{
+			AddKeys(Grips[i].GripID, GetIndexedGripObject(Grips[i]), i);
+		}
+
+		IndexedNum = Grips.Num();
+		bDirty = false;
+		bVerified = true;
+	}
+
+	// Call after appending a grip to the array
+	void NotifyAdded(const TArray<GripType> & Grips, int32 Index)
+	{
+		if (bDirty || Index != Grips.Num() - 1 || IndexedNum != Index)
+		{
+			MarkDirty();
+			return;
+		}
+
+		AddKeys(Grips[Index].GripID, GetIndexedGripObject(Grips[Index]), Index);
+		IndexedNum = Grips.Num();
+	}
+
+	// Call after Grips.RemoveAt(Index) with the keys of the removed grip
+	void NotifyRemoved(const TArray<GripType> & Grips, int32 Index, uint8 RemovedGripID, const UObject * RemovedObject)
+	{
+		if (bDirty || bHasDuplicateKeys || IndexedNum != Grips.Num() + 1)
+		{
+			MarkDirty();
+			return;
+		}
+
+		RemoveKey(ByGripID, RemovedGripID, Index);
+		RemoveKey(ByObject, RemovedObject, Index);
+
+		// Everything after the removed slot moved down one
+		for (TPair<uint8, int32> & Pair : ByGripID)
+		{
+			if (Pair.Value > Index)
+				--Pair.Value;
+		}
+
+		for (TPair<const UObject*, int32> & Pair : ByObject)
+		{
+			if (Pair.Value > Index)
+				--Pair.Value;
+		}
+
+		IndexedNum = Grips.Num();
+	}
+
+	GripType * Find(TArray<GripType> & Grips, uint8 GripID)
+	{
+		if (GripID == INVALID_VRGRIP_ID)
+			return nullptr;
+
+		return FindInMap(Grips, ByGripID, GripID, [GripID](const GripType & Grip) { return Grip.GripID == GripID; });
+	}
+
+	GripType * Find(TArray<GripType> & Grips, const UObject * Object)
+	{
+		if (!Object)
+			return nullptr;
+
+		return FindInMap(Grips, ByObject, Object, [Object](const GripType & Grip) { return GetIndexedGripObject(Grip) == Object; });
+	}
+
+	int32 IndexOf(TArray<GripType> & Grips, uint8 GripID)
+	{
+		GripType * Grip = Find(Grips, GripID);
+		return Grip ? (int32)(Grip - Grips.GetData()) : INDEX_NONE;
+	}
+
+private:
+
+	void AddKeys(uint8 GripID, const UObject * GripObject, int32 Index)
+	{
+		if (GripID != INVALID_VRGRIP_ID)
+		{
+			if (ByGripID.Contains(GripID))
+				bHasDuplicateKeys = true;
+			else
+				ByGripID.Add(GripID, Index);
+		}
+
+		if (GripObject)
+		{
+			if (ByObject.Contains(GripObject))
+				bHasDuplicateKeys = true;
+			else
+				ByObject.Add(GripObject, Index);
+		}
+	}
+
+	template<typename KeyType>
+	static void RemoveKey(TMap<KeyType, int32> & Map, const KeyType & Key, int32 Index)
+	{
+		const int32 * FoundIndex = Map.Find(Key);
+		if (FoundIndex && *FoundIndex == Index)
+			Map.Remove(Key);
+	}
+
+	template<typename KeyType, typename PredicateType>
+	GripType * FindInMap(TArray<GripType> & Grips, const TMap<KeyType, int32> & Map, const KeyType & Key, const PredicateType & Matches)
+	{
+		if (bDirty || IndexedNum != Grips.Num())
+			Rebuild(Grips);
+
+		const int32 * Index = Map.Find(Key);
+		if (Index && Grips.IsValidIndex(*Index) && Matches(Grips[*Index]))
+			return &Grips[*Index];
+
+		// A miss right after a rebuild is a real miss
+		if (!Index && bVerified)
+			return nullptr;
+
+		// Stale slot, or a miss that the last change may have caused without marking, rebuild and look again
+		Rebuild(Grips);
+		Index = Map.Find(Key);
+		return Index ? &Grips[*Index] : nullptr;
+	}
+};
+
+/**
+* A post teleport move queued during TickGrip, all of a controllers moves are applied together once every grip has been resolved.
+*/
+struct FVRGripTeleportMove
+{
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+	FTransform WorldTransform;
+	uint8 GripID;
+	bool bTeleportPhysicsHandle;
+};
+
 /**
 * An override of the MotionControllerComponent that implements position replication and Gripping with grip replication and controllable late updates per object.
 */
@@ -223,12 +398,75 @@ public:
 	}
 
 	// When possible I suggest that you use GetAllGrips/GetGrippedObjects instead of directly referencing this
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "GripMotionController", ReplicatedUsing = OnRep_GrippedObjects)
-	TArray<FBPActorGripInformation> GrippedObjects;
+	// Blueprints read it through GetReplicatedGrips, the delta replicated container isn't exposed directly
+	UPROPERTY(Replicated, ReplicatedUsing = OnRep_GrippedObjects)
+	FBPActorGripArray GrippedObjects;
 
 	// When possible I suggest that you use GetAllGrips/GetGrippedObjects instead of directly referencing this
-	UPROPERTY(BlueprintReadOnly, Replicated, Category = "GripMotionController", ReplicatedUsing = OnRep_LocallyGrippedObjects)
-	TArray<FBPActorGripInformation> LocallyGrippedObjects;
+	// Blueprints read it through GetLocalGrips, the delta replicated container isn't exposed directly
+	UPROPERTY(Replicated, ReplicatedUsing = OnRep_LocallyGrippedObjects)
+	FBPActorGripArray LocallyGrippedObjects;
+
+	// Indexed lookups into GrippedObjects / LocallyGrippedObjects, same results as FindByKey
+	FORCEINLINE FBPActorGripInformation * FindReplicatedGrip(const UObject * Object) { return GrippedObjectsIndex.Find(GrippedObjects.Grips, Object); }
+	FORCEINLINE FBPActorGripInformation * FindReplicatedGrip(uint8 GripID) { return GrippedObjectsIndex.Find(GrippedObjects.Grips, GripID); }
+	FORCEINLINE FBPActorGripInformation * FindReplicatedGrip(const FBPActorGripInformation & Grip) { return GrippedObjectsIndex.Find(GrippedObjects.Grips, Grip.GripID); }
+	FORCEINLINE FBPActorGripInformation * FindLocalGrip(const UObject * Object) { return LocallyGrippedObjectsIndex.Find(LocallyGrippedObjects.Grips, Object); }
+	FORCEINLINE FBPActorGripInformation * FindLocalGrip(uint8 GripID) { return LocallyGrippedObjectsIndex.Find(LocallyGrippedObjects.Grips, GripID); }
+	FORCEINLINE FBPActorGripInformation * FindLocalGrip(const FBPActorGripInformation & Grip) { return LocallyGrippedObjectsIndex.Find(LocallyGrippedObjects.Grips, Grip.GripID); }
+
+	// Replicated grips first, then local ones
+	template<typename KeyType>
+	FORCEINLINE FBPActorGripInformation * FindGrip(const KeyType & Key)
+	{
+		FBPActorGripInformation * GripInfo = FindReplicatedGrip(Key);
+		return GripInfo ? GripInfo : FindLocalGrip(Key);
+	}
+
+	// Has to be called after changing the arrays without the helpers below
+	FORCEINLINE void MarkGripIndexDirty()
+	{
+		GrippedObjectsIndex.MarkDirty();
+		LocallyGrippedObjectsIndex.MarkDirty();
+		PhysicsGripsIndex.MarkDirty();
+	}
+
+	// Add / remove grips and keep the indexes current without a rebuild
+	FORCEINLINE int32 AddReplicatedGrip(const FBPActorGripInformation & Grip)
+	{
+		int32 Index = GrippedObjects.AddGrip(Grip);
+		GrippedObjectsIndex.NotifyAdded(GrippedObjects.Grips, Index);
+		return Index;
+	}
+
+	FORCEINLINE int32 AddLocalGrip(const FBPActorGripInformation & Grip)
+	{
+		int32 Index = LocallyGrippedObjects.AddGrip(Grip);
+		LocallyGrippedObjectsIndex.NotifyAdded(LocallyGrippedObjects.Grips, Index);
+		return Index;
+	}
+
+	FORCEINLINE void RemoveReplicatedGripAt(int32 Index)
+	{
+		const uint8 GripID = GrippedObjects.Grips[Index].GripID;
+		const UObject * GrippedObject = GrippedObjects.Grips[Index].GrippedObject;
+		GrippedObjects.RemoveGripAt(Index);
+		GrippedObjectsIndex.NotifyRemoved(GrippedObjects.Grips, Index, GripID, GrippedObject);
+	}
+
+	FORCEINLINE void RemoveLocalGripAt(int32 Index)
+	{
+		const uint8 GripID = LocallyGrippedObjects.Grips[Index].GripID;
+		const UObject * GrippedObject = LocallyGrippedObjects.Grips[Index].GrippedObject;
+		LocallyGrippedObjects.RemoveGripAt(Index);
+		LocallyGrippedObjectsIndex.NotifyRemoved(LocallyGrippedObjects.Grips, Index, GripID, GrippedObject);
+	}
+
+	TVRGripIndex<FBPActorGripInformation> GrippedObjectsIndex;
+	TVRGripIndex<FBPActorGripInformation> LocallyGrippedObjectsIndex;
+
+	// Has to be called after changing replicated values of a grip in either array, grips that aren't marked aren't sent
+	void MarkGripDirty(FBPActorGripInformation & Grip);
 
 	// Locally Gripped Array functions
 
@@ -275,7 +513,7 @@ public:
 		if (GetPhysicsGripIndex(GripInfo, HandleIndex))
 		{
 			DestroyPhysicsHandle(PhysicsGrips[HandleIndex].SceneIndex, &PhysicsGrips[HandleIndex].HandleData, &PhysicsGrips[HandleIndex].KinActorData);
-			PhysicsGrips.RemoveAt(HandleIndex);
+			RemovePhysicsGripAt(HandleIndex);
 		}
 
 		// Grip Type or replication was changed
@@ -286,24 +524,19 @@ public:
 	virtual void OnRep_GrippedObjects(/*TArray<FBPActorGripInformation> OriginalArrayState*/) // Original array state is useless without full serialize, it just hold last delta
 	{
 		// Need to think about how best to handle the simulating flag here, don't handle for now
-		// Check for removed gripped actors
-		// This might actually be better left as an RPC multicast
-
-		for (int i = GrippedObjects.Num() - 1; i >= 0; --i)
-		{
-			HandleGripReplication(GrippedObjects[i]);
-		}
+		// Removed grips are dropped by the drop RPCs
+		HandlePendingGripReplication(GrippedObjects);
 	}
 
 	UFUNCTION()
 	virtual void OnRep_LocallyGrippedObjects()
 	{
-		for (int i = LocallyGrippedObjects.Num() - 1; i >= 0; --i)
-		{
-			HandleGripReplication(LocallyGrippedObjects[i]);
-		}
+		HandlePendingGripReplication(LocallyGrippedObjects);
 	}
 
+	// Runs HandleGripReplication on the grips that the last delta added or changed
+	void HandlePendingGripReplication(FBPActorGripArray & GripArray);
+
 	// Handles variable state changes and specific actions on a grip replication
 	inline bool HandleGripReplication(FBPActorGripInformation & Grip);
 
@@ -327,7 +560,8 @@ public:
 	{
 		//ReplicatedControllerTransform.Unpack();
 
-		if (bSmoothReplicatedMotion)
+		// Servers without a view just snap to the new transform, unless it is driving server side physics grips
+		if (bSmoothReplicatedMotion && (!UVRGlobalSettings::IsServerOptimized() || PhysicsGrips.Num() > 0))
 		{
 			if (bReppedOnce)
 			{
@@ -703,7 +937,7 @@ public:
 		if (!ObjectToCheck)
 			return false;
 
-		return (GrippedObjects.FindByKey(ObjectToCheck) || LocallyGrippedObjects.FindByKey(ObjectToCheck));
+		return (GrippedObjects.Grips.FindByKey(ObjectToCheck) || LocallyGrippedObjects.Grips.FindByKey(ObjectToCheck));
 	}
 
 	// Gets if the given actor is held by this controller
@@ -713,7 +947,7 @@ public:
 		if (!ActorToCheck)
 			return false;
 
-		return (GrippedObjects.FindByKey(ActorToCheck) || LocallyGrippedObjects.FindByKey(ActorToCheck));
+		return (GrippedObjects.Grips.FindByKey(ActorToCheck) || LocallyGrippedObjects.Grips.FindByKey(ActorToCheck));
 	}
 
 	// Gets if the given component is held by this controller
@@ -723,7 +957,7 @@ public:
 		if (!ComponentToCheck)
 			return false;
 
-		return (GrippedObjects.FindByKey(ComponentToCheck) || LocallyGrippedObjects.FindByKey(ComponentToCheck));
+		return (GrippedObjects.Grips.FindByKey(ComponentToCheck) || LocallyGrippedObjects.Grips.FindByKey(ComponentToCheck));
 
 		return false;
 	}
@@ -735,20 +969,20 @@ public:
 		if (!ComponentToCheck)
 			return false;
 
-		for (int i = 0; i < GrippedObjects.Num(); ++i)
+		for (int i = 0; i < GrippedObjects.Grips.Num(); ++i)
 		{
-			if(GrippedObjects[i].SecondaryGripInfo.bHasSecondaryAttachment && GrippedObjects[i].SecondaryGripInfo.SecondaryAttachment == ComponentToCheck)
+			if(GrippedObjects.Grips[i].SecondaryGripInfo.bHasSecondaryAttachment && GrippedObjects.Grips[i].SecondaryGripInfo.SecondaryAttachment == ComponentToCheck)
 			{
-				Grip = GrippedObjects[i];
+				Grip = GrippedObjects.Grips[i];
 				return true;
 			}
 		}
 
-		for (int i = 0; i < LocallyGrippedObjects.Num(); ++i)
+		for (int i = 0; i < LocallyGrippedObjects.Grips.Num(); ++i)
 		{
-			if (LocallyGrippedObjects[i].SecondaryGripInfo.bHasSecondaryAttachment && LocallyGrippedObjects[i].SecondaryGripInfo.SecondaryAttachment == ComponentToCheck)
+			if (LocallyGrippedObjects.Grips[i].SecondaryGripInfo.bHasSecondaryAttachment && LocallyGrippedObjects.Grips[i].SecondaryGripInfo.SecondaryAttachment == ComponentToCheck)
 			{
-				Grip = LocallyGrippedObjects[i];
+				Grip = LocallyGrippedObjects.Grips[i];
 				return true;
 			}
 		}
@@ -760,13 +994,21 @@ public:
 	UFUNCTION(BlueprintPure, Category = "GripMotionController")
 	bool HasGrippedObjects()
 	{
-		return GrippedObjects.Num() > 0 || LocallyGrippedObjects.Num() > 0;
+		return GrippedObjects.Grips.Num() > 0 || LocallyGrippedObjects.Grips.Num() > 0;
 	}
 
 	// Get list of all gripped objects grip info structures (local and normal both)
 	UFUNCTION(BlueprintPure, Category = "GripMotionController")
 		void GetAllGrips(TArray<FBPActorGripInformation> &GripArray);
 
+	// Get the replicated grips, replaces reading the GrippedObjects array in blueprint
+	UFUNCTION(BlueprintPure, Category = "GripMotionController")
+		void GetReplicatedGrips(TArray<FBPActorGripInformation> &GripArray);
+
+	// Get the local grips, replaces reading the LocallyGrippedObjects array in blueprint
+	UFUNCTION(BlueprintPure, Category = "GripMotionController")
+		void GetLocalGrips(TArray<FBPActorGripInformation> &GripArray);
+
 	// Get list of all gripped actors
 	UFUNCTION(BlueprintPure, Category = "GripMotionController")
 	void GetGrippedActors(TArray<AActor*> &GrippedActorArray);
@@ -801,7 +1043,11 @@ public:
 	// bIsForPostTeleport says whether we shuld allow the DropOnTeleport logic to apply or not
 	UFUNCTION(BlueprintCallable, Category = "GripMotionController")
 	bool TeleportMoveGrip(UPARAM(ref)FBPActorGripInformation &Grip, bool bTeleportPhysicsGrips = true, bool bIsForPostTeleport = false);
-	bool TeleportMoveGrip_Impl(FBPActorGripInformation &Grip, bool bTeleportPhysicsGrips, bool bIsForPostTeleport, FTransform & OptionalTransform);
+	bool TeleportMoveGrip_Impl(FBPActorGripInformation &Grip, bool bTeleportPhysicsGrips, bool bIsForPostTeleport, FTransform & OptionalTransform, bool bBatchMove = false);
+
+	// Post teleport moves queued by TickGrip, flushed in one pass with a single physics scene lock at the end of it
+	TArray<FVRGripTeleportMove> PendingTeleportMoves;
+	void FlushTeleportMoves();
 
 	// Adds a secondary attachment point to the grip
 	UFUNCTION(BlueprintCallable, Category = "GripMotionController")
@@ -834,6 +1080,8 @@ public:
 	bool GetPhysicsJointLength(const FBPActorGripInformation &GrippedActor, UPrimitiveComponent * rootComp, FVector & LocOut);
 
 	TArray<FBPActorPhysicsHandleInformation> PhysicsGrips;
+	TVRGripIndex<FBPActorPhysicsHandleInformation> PhysicsGripsIndex;
+	void RemovePhysicsGripAt(int32 Index);
 	FBPActorPhysicsHandleInformation * GetPhysicsGrip(const FBPActorGripInformation & GripInfo);
 	bool GetPhysicsGripIndex(const FBPActorGripInformation & GripInfo, int & index);
 	FBPActorPhysicsHandleInformation * CreatePhysicsGrip(const FBPActorGripInformation & GripInfo);
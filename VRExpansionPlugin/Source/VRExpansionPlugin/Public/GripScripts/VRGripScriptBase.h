@@ -16,6 +16,8 @@
 #include "VRGripScriptBase.generated.h"
 
 class UGripMotionControllerComponent;
+class UActorChannel;
+struct FReplicationFlags;
 
 UENUM(Blueprintable)
 enum class EGSTransformOverrideType : uint8
@@ -72,6 +74,19 @@ public:
 	virtual bool Wants_DenyTeleport_Implementation();*/
 
 	virtual void GetLifetimeReplicatedProps(TArray< class FLifetimeProperty > & OutLifetimeProps) const override;
+
+	// If true this script is only replicated after MarkReplicatedStateDirty is called instead of on every net update of its owner.
+	// Scripts without replicated properties are only ever replicated initially.
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "DefaultSettings")
+	bool bReplicateOnlyWhenDirty;
+
+	// Has the owners channels send this scripts replicated properties again, call after changing them with bReplicateOnlyWhenDirty set
+	UFUNCTION(BlueprintCallable, Category = "VRGripScript")
+	void MarkReplicatedStateDirty();
+
+	// Called by the grippables ReplicateSubobjects, false if the channel already has the current state of this script
+	bool ShouldReplicateToChannel(UActorChannel * Channel, const FReplicationFlags & RepFlags);
+
 	virtual bool CallRemoteFunction(UFunction * Function, void * Parms, FOutParmRec * OutParms, FFrame * Stack) override;
 	virtual int32 GetFunctionCallspace(UFunction * Function, void * Parameters, FFrame * Stack) override;
 
@@ -169,6 +184,11 @@ public:
 	{
 		GetWorldTransform_Implementation(OwningController, DeltaTime, WorldTransform, ParentTransform, Grip, actor, root, bRootHasInterface, bActorHasInterface);
 	}
+
+private:
+
+	// Channels that have been sent the current state of this script, reset when it is marked dirty
+	TSet<TWeakObjectPtr<UActorChannel>> ReplicatedChannels;
 };
 
 
@@ -59,6 +59,19 @@ public:
 	UPROPERTY(EditAnywhere, Replicated, BlueprintReadWrite, Category = "Replication")
 		bool bAllowIgnoringAttachOnOwner;
 
+	// If true the server puts this actor to net dormancy once it is released and its physics has come to rest, it wakes again when gripped or when its physics wakes.
+	// Replicated properties changed by hand while it is dormant need a FlushNetDormancy to be sent.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication")
+		bool bAutoNetDormancy;
+
+	virtual void PreRegisterAllComponents() override;
+
+	// Wakes the actor or puts it to net dormancy depending on if it is held and at rest
+	void UpdateAutoNetDormancy();
+
+	UFUNCTION()
+		void OnRootPhysicsWakeOrSleep(UPrimitiveComponent * PhysicsComponent, FName BoneName);
+
 	// Should we skip attachment replication (vr settings say we are a client auth grip and our owner is locally controlled)
 	inline bool ShouldWeSkipAttachmentReplication() const
 	{
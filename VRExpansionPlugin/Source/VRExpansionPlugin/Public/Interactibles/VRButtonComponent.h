@@ -45,6 +45,7 @@ public:
 
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 	virtual void BeginPlay() override;
+	virtual void OnUnregister() override;
 
 	UFUNCTION(BlueprintPure, Category = "VRButtonComponent")
 	bool IsButtonInUse()
@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "UObject/ObjectKey.h"
+
+class UActorComponent;
+class UWorld;
+struct FVRInteractibleWorldSimulation;
+
+/**
+* Single tick function that steps every awake interactible in a world.
+*/
+struct FVRInteractibleTickFunction : public FTickFunction
+{
+	FVRInteractibleWorldSimulation * Simulation;
+
+	FVRInteractibleTickFunction() :
+		Simulation(nullptr)
+	{}
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+/**
+* The awake interactibles of one world, kept in a flat array and stepped together.
+*/
+struct FVRInteractibleWorldSimulation
+{
+	UWorld * World;
+	FVRInteractibleTickFunction TickFunction;
+
+	TArray<UActorComponent*> Components;
+	TMap<UActorComponent*, int32> ComponentIndices;
+
+	// Copy of Components taken at the start of a tick, components can wake or sleep others while it runs
+	TArray<UActorComponent*> TickingComponents;
+	TArray<UActorComponent*> SleptDuringTick;
+	bool bTicking;
+
+	FVRInteractibleWorldSimulation(UWorld * InWorld);
+	~FVRInteractibleWorldSimulation();
+
+	void Add(UActorComponent * Component);
+	void Remove(UActorComponent * Component);
+	void Tick(float DeltaTime, ELevelTick TickType);
+};
+
+/**
+* Runs the return / momentum simulation of the lever, slider, dial and button components.
+* Instead of enabling their own tick function while they move, interactibles are woken here and are stepped
+* by one tick function per world (TG_DuringPhysics, same as the component default). vre.BatchInteractibleTicks 0 falls back to per component ticks.
+*/
+class VREXPANSIONPLUGIN_API FVRInteractibleSimulation
+{
+public:
+
+	static FVRInteractibleSimulation & Get();
+
+	// True if interactibles are stepped by the batched tick
+	static bool IsEnabled();
+
+	// Starts stepping the component every frame
+	void Wake(UActorComponent * Component);
+
+	// Stops stepping the component, safe to call on components that are not awake
+	void Sleep(UActorComponent * Component);
+
+	bool IsAwake(const UActorComponent * Component) const;
+
+	// Number of components being stepped by the batched tick in the world
+	int32 GetNumAwake(const UWorld * World) const;
+
+private:
+
+	FVRInteractibleSimulation();
+
+	FVRInteractibleWorldSimulation * FindWorldSimulation(const UWorld * World) const;
+	void OnWorldCleanup(UWorld * World, bool bSessionEnded, bool bCleanupResources);
+
+	TMap<FObjectKey, TUniquePtr<FVRInteractibleWorldSimulation>> WorldSimulations;
+};
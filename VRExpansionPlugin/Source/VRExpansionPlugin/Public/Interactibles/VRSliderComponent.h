@@ -10,6 +10,7 @@
 #include "GameplayTagAssetInterface.h"
 #include "Components/SplineComponent.h"
 #include "VRInteractibleFunctionLibrary.h"
+#include "Interactibles/VRSplineLookupTable.h"
 
 #include "VRSliderComponent.generated.h"
 
@@ -137,6 +138,29 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRSliderComponent", meta = (ClampMin = "0", UIMin = "0"))
 		float SplineLerpValue;
 
+	// Bakes the followed spline into a lookup table for closest point and progress queries instead of searching the spline itself every grip tick
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRSliderComponent")
+		bool bUseSplineLookupTable;
+
+	// Largest distance (spline space) the lookup table can stray from the spline, more samples are baked to stay under it
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRSliderComponent", meta = (ClampMin = "0.001", UIMin = "0.001"))
+		float SplineLookupMaxError;
+
+	FVRSplineLookupTable SplineLookupTable;
+
+	// Forces the spline lookup table to rebuild, it already does when the spline length or point count changes
+	UFUNCTION(BlueprintCallable, Category = "VRSliderComponent")
+	void InvalidateSplineLookupTable()
+	{
+		SplineLookupTable.Reset();
+	}
+
+	// Closest input key on the followed spline, through the lookup table if enabled
+	float FindSplineInputKeyClosestToWorldLocation(const FVector & WorldLocation);
+
+	// Input key at a distance along the followed spline, through the lookup table if enabled
+	float GetSplineInputKeyAtDistance(float Distance);
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRSliderComponent")
 		bool bSliderUsesSnapPoints;
 
@@ -204,14 +228,14 @@ public:
 			
 			if (bFollowSplineRotationAndScale)
 			{
-				FTransform trans = SplineComponentToFollow->GetTransformAtDistanceAlongSpline(splineProgress, ESplineCoordinateSpace::World, true);
+				FTransform trans = SplineComponentToFollow->GetTransformAtSplineInputKey(GetSplineInputKeyAtDistance(splineProgress), ESplineCoordinateSpace::World, true);
 				trans.MultiplyScale3D(InitialRelativeTransform.GetScale3D());
 				trans = trans * ParentTransform.Inverse();
 				this->SetRelativeTransform(trans);
 			}
 			else
 			{
-				this->SetRelativeLocation(ParentTransform.InverseTransformPosition(SplineComponentToFollow->GetLocationAtDistanceAlongSpline(splineProgress, ESplineCoordinateSpace::World)));
+				this->SetRelativeLocation(ParentTransform.InverseTransformPosition(SplineComponentToFollow->GetLocationAtSplineInputKey(GetSplineInputKeyAtDistance(splineProgress), ESplineCoordinateSpace::World)));
 			}
 		}
 		else // Not a spline follow
@@ -243,7 +267,7 @@ public:
 
 		if (SplineComponentToFollow != nullptr)
 		{
-			FTransform WorldTransform = SplineComponentToFollow->FindTransformClosestToWorldLocation(this->GetComponentLocation(), ESplineCoordinateSpace::World, true);
+			FTransform WorldTransform = SplineComponentToFollow->GetTransformAtSplineInputKey(FindSplineInputKeyClosestToWorldLocation(this->GetComponentLocation()), ESplineCoordinateSpace::World, true);
 			if (bFollowSplineRotationAndScale)
 			{
 				WorldTransform.MultiplyScale3D(InitialRelativeTransform.GetScale3D());
@@ -295,7 +319,7 @@ public:
 			float ClosestKey = CurKey;
 			
 			if (!bUseKeyInstead)
-				ClosestKey = SplineComponentToFollow->FindInputKeyClosestToWorldLocation(CurLocation);
+				ClosestKey = FindSplineInputKeyClosestToWorldLocation(CurLocation);
 
 			int32 primaryKey = FMath::TruncToInt(ClosestKey);
 
@@ -367,6 +391,7 @@ public:
 
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 	virtual void BeginPlay() override;
+	virtual void OnUnregister() override;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRGripInterface")
 		EGripMovementReplicationSettings MovementReplicationSetting;
@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class USplineComponent;
+
+/**
+* Spline baked into a polyline sampled at even distances, in spline component space.
+* Samples are doubled until the polyline stays within MaxError of the spline, so closest point queries search the polyline
+* (bounds of each chunk of samples first, then the segments of the chunks that can still be closer) instead of a per segment
+* search of the curve, and distance to input key is a direct index.
+*/
+struct VREXPANSIONPLUGIN_API FVRSplineLookupTable
+{
+	TArray<FVector> Positions;
+	TArray<float> InputKeys;
+	float SampleDistance;
+
+	// Largest measured distance between the polyline and the spline
+	float MeasuredError;
+
+	// Bounds of each run of consecutive segments of the polyline
+	TArray<FBox> ChunkBounds;
+
+	FVRSplineLookupTable();
+
+	bool IsValid() const { return Positions.Num() > 1; }
+
+	void Reset();
+
+	// Rebuilds the table if it was built for a different spline, error or the spline changed since, returns false if the spline can't be baked
+	bool Update(const USplineComponent * InSpline, float InMaxError);
+
+	// Input key and distance along the spline closest to the world location
+	float FindInputKeyClosestToWorldLocation(const USplineComponent * InSpline, const FVector & WorldLocation, float * OutDistance = nullptr) const;
+
+	float GetInputKeyAtDistance(float Distance) const;
+
+private:
+
+	void Build(const USplineComponent * InSpline, float InMaxError);
+
+	// Checks the segments of one chunk against the closest found so far
+	void FindClosestInChunk(int32 Chunk, const FVector & LocalLocation, int32 & ClosestIndex, float & ClosestAlpha, float & ClosestDistSq) const;
+
+	// What the table was built from
+	TWeakObjectPtr<const USplineComponent> Spline;
+	float MaxError;
+	int32 NumSplinePoints;
+	bool bClosedLoop;
+	float SplineLength;
+};
@@ -7,6 +7,7 @@
 #include "AIModule/Classes/GenericTeamAgentInterface.h"
 #include "AIModule/Classes/Perception/AISense.h"
 #include "AIModule/Classes/Perception/AISenseConfig.h"
+#include "WorldCollision.h"
 
 #include "VRAIPerceptionOverrides.generated.h"
 
@@ -101,6 +102,9 @@ struct FAISightTargetVR
 	FGenericTeamId TeamId;
 	FTargetId TargetId;
 
+	// Refreshed once per update by the query selection pass
+	FVector CachedLocation;
+
 	FAISightTargetVR(AActor* InTarget = NULL, FGenericTeamId InTeamId = FGenericTeamId::NoTeam);
 
 	FORCEINLINE FVector GetLocationSimple() const
@@ -126,8 +130,11 @@ struct FAISightQueryVR
 
 	uint32 bLastResult : 1;
 
+	// Waiting on an async line of sight trace, see UAISense_Sight_VR::bUseAsyncSightTraces
+	uint32 bTracePending : 1;
+
 	FAISightQueryVR(FPerceptionListenerID ListenerId = FPerceptionListenerID::InvalidID(), FAISightTargetVR::FTargetId Target = FAISightTargetVR::InvalidTargetId)
-		: ObserverId(ListenerId), TargetId(Target), Age(0), Score(0), Importance(0), LastSeenLocation(FAISystem::InvalidLocation), bLastResult(false)
+		: ObserverId(ListenerId), TargetId(Target), Age(0), Score(0), Importance(0), LastSeenLocation(FAISystem::InvalidLocation), bLastResult(false), bTracePending(false)
 	{
 	}
 
@@ -155,6 +162,17 @@ struct FAISightQueryVR
 	};
 };
 
+// An async line of sight trace that was submitted for a query and is read back on the next update
+struct FAISightPendingTraceVR
+{
+	FTraceHandle TraceHandle;
+	FPerceptionListenerID ObserverId;
+	FAISightTargetVR::FTargetId TargetId;
+	FVector TargetLocation;
+	float SightRadiusSq;
+	uint64 SubmitFrame;
+};
+
 UCLASS(ClassGroup = AI, config = Game)
 class VREXPANSIONPLUGIN_API UAISense_Sight_VR : public UAISense
 {
@@ -200,8 +218,54 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
 		float SightLimitQueryImportance;
 
+	/** Batch the line of sight checks of all due queries into async traces that are read back on the next update instead of tracing synchronously */
+	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
+		bool bUseAsyncSightTraces;
+
+	/** Maximum number of async sight traces in flight when bUseAsyncSightTraces is on */
+	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
+		int32 MaxAsyncTracesPerTick;
+
+	/** Score all queries in one pass and pick the top MaxTracesPerTick to trace instead of sorting the whole queue every update.
+	* Queries outside of the sight pie are resolved as soon as the time slice allows instead of waiting for their turn.
+	* Off until the VRExpansionPlugin.AISightQuerySelection benchmark has been run to compare it with the sorted queue */
+	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
+		bool bUseQuerySelection;
+
+	/** Query count from which the scoring pass of bUseQuerySelection is spread over worker threads */
+	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
+		int32 MinQueriesForParallelScoring;
+
 	ECollisionChannel DefaultSightCollisionChannel;
 
+	TArray<FAISightPendingTraceVR> PendingSightTraces;
+	TMap<uint64, int32> PendingSightTraceLookup;
+
+	// Flat arrays of the queries gathered for a batched update, kept between updates to avoid reallocating
+	struct FSightQueryBatch
+	{
+		TArray<int32> QueryIndices;
+		TArray<FPerceptionListener*> Listeners;
+		TArray<FAISightTargetVR*> Targets;
+		TArray<const FDigestedSightProperties*> Digests;
+		TArray<FVector> ListenerLocations;
+		TArray<FVector> ListenerDirections;
+		TArray<FVector> TargetLocations;
+		TArray<float> SightRadiusSq;
+		TArray<float> PeripheralVisionAngleCos;
+		TArray<uint8> InSightPie;
+
+		// Only filled by the query selection pass
+		TArray<float> Scores;
+		TArray<float> Importance;
+		TArray<int32> Selected;
+		TBitArray<> Handled;
+
+		int32 Num() const { return QueryIndices.Num(); }
+		void Reset();
+	};
+	FSightQueryBatch SightQueryBatch;
+
 public:
 
 	virtual void PostInitProperties() override;
@@ -240,4 +304,19 @@ protected:
 	FORCEINLINE void SortQueries() { SightQueryQueue.Sort(FAISightQueryVR::FSortPredicate()); }
 
 	float CalcQueryImportance(const FPerceptionListener& Listener, const FVector& TargetLocation, const float SightRadiusSq) const;
+	float CalcQueryImportance(const float DistanceSq, const float SightRadiusSq) const;
+
+	/** Gathers every query into the batch, scores and culls them in parallel and runs line of sight checks on the top MaxTracesPerTick. Returns the number of queries looked at */
+	int32 UpdateSelectedQueries(UWorld* World, TArray<int32>& InvalidQueries, TArray<FAISightTargetVR::FTargetId>& InvalidTargets, bool& bOutHitTimeSliceLimit);
+
+	/** Synchronous line of sight check of a query whose target is in the sight pie, returns the number of traces done */
+	int32 CheckLineOfSight(UWorld* World, const FDigestedSightProperties& PropDigest, FPerceptionListener& Listener, FAISightTargetVR& Target, FAISightQueryVR& SightQuery, const FVector& TargetLocation);
+
+	/** Gathers the due queries, runs the sight pie test over all of them at once and submits async traces for the ones that pass. Returns the number of queries looked at */
+	int32 SubmitBatchedQueries(UWorld* World, TArray<int32>& InvalidQueries, TArray<FAISightTargetVR::FTargetId>& InvalidTargets);
+
+	/** Applies the results of the async traces submitted on earlier frames */
+	void ConsumeAsyncSightTraces(UWorld* World);
+
+	void ApplySightResult(FPerceptionListener& Listener, AActor* TargetActor, FAISightQueryVR& SightQuery, bool bVisible, const FVector& SeenLocation, const FVector& TargetLocation, float StimulusStrength);
 };
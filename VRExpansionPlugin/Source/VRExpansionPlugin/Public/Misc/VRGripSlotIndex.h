@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class USceneComponent;
+
+/**
+* All of the sockets on a mesh whose name contains a given slot type.
+* Static mesh sockets don't move, so their component space transforms are stored directly.
+* Skeletal mesh sockets follow the animation, so only the names are kept and sampled at query time.
+*/
+struct FVRGripSlotGroup
+{
+	TArray<FName> SocketNames;
+	TArray<FTransform> ComponentSpaceTransforms;
+};
+
+/**
+* Per mesh asset record of the grip slot groups that have been requested from it.
+*/
+struct FVRGripSlotMeshEntry
+{
+	TWeakObjectPtr<UObject> MeshAsset;
+
+	// Socket (and bone) count at the time the entry was built, a mismatch rebuilds the entry
+	int32 SocketCount;
+
+	TMap<FName, FVRGripSlotGroup> SlotGroups;
+
+	FVRGripSlotMeshEntry() :
+		SocketCount(0)
+	{}
+};
+
+/**
+* Game thread cache of grip slots keyed by mesh asset.
+* The socket name matching happens once per mesh and slot type, after that finding the nearest slot is only distance checks.
+* Components without a static or skeletal mesh fall back to the uncached search.
+*/
+class VREXPANSIONPLUGIN_API FVRGripSlotIndex
+{
+public:
+
+	static FVRGripSlotIndex & Get();
+
+	// Finds the closest socket whose name contains SlotType and that is within MaxRange of WorldLocation
+	void GetGripSlotInRange(FName SlotType, USceneComponent * Component, const FVector & WorldLocation, float MaxRange, bool & bHadSlotInRange, FTransform & SlotWorldTransform);
+
+	// Drops all cached slots, they will be rebuilt on next request
+	void Empty();
+
+private:
+
+	FVRGripSlotIndex();
+
+	const FVRGripSlotGroup * FindOrBuildSlotGroup(FName SlotType, USceneComponent * Component, UObject * MeshAsset, int32 SocketCount, bool bStaticSockets);
+	void OnPostGarbageCollect();
+
+#if WITH_EDITOR
+	void OnObjectPropertyChanged(UObject * Object, struct FPropertyChangedEvent & PropertyChangedEvent);
+#endif
+
+	TMap<FObjectKey, FVRGripSlotMeshEntry> MeshEntries;
+};
@@ -8,6 +8,7 @@
 #include "Engine/Console.h"
 #include "Framework/Text/TextRange.h"
 #include "Core/Public/Misc/OutputDeviceHelper.h"
+#include "VRGlobalSettings.h"
 #include "VRLogComponent.generated.h"
 
 /**
@@ -59,18 +60,39 @@ public:
 	int32 MaxStoredMessages;
 	bool bIsDirty;
 	int32 MaxLineLength;
+	bool bIsCapturing;
 
 	FVROutputLogHistory()
 	{
 		MaxLineLength = 130;
 		bIsDirty = false;
 		MaxStoredMessages = 1000;
+		bIsCapturing = false;
+	}
+
+	~FVROutputLogHistory()
+	{
+		StopCapture();
+	}
+
+	// Hooks into GLog and pulls in the backlog, nothing is formatted or stored until this is called
+	void StartCapture()
+	{
+		if (bIsCapturing || GLog == NULL)
+			return;
+
+		bIsCapturing = true;
 		GLog->AddOutputDevice(this);
 		GLog->SerializeBacklog(this);
 	}
 
-	~FVROutputLogHistory()
+	void StopCapture()
 	{
+		if (!bIsCapturing)
+			return;
+
+		bIsCapturing = false;
+
 		// At shutdown, GLog may already be null
 		if (GLog != NULL)
 		{
@@ -211,6 +233,10 @@ public:
 		Super::PostInitProperties();
 		OutputLogHistory.MaxStoredMessages = FMath::Clamp(MaxStoredMessages, 100, 100000);
 		OutputLogHistory.MaxLineLength = FMath::Clamp(MaxLineLength, 50, 1000);
+
+		// Templates never draw, and optimized servers have nothing to draw to
+		if (!HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject) && !UVRGlobalSettings::IsServerOptimized())
+			OutputLogHistory.StartCapture();
 	}
 
 	UPROPERTY(BlueprintReadWrite,EditAnywhere, Category = "VRLogComponent|Console")
@@ -0,0 +1,126 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VRBaseCharacterMovementComponent.h"
+
+class AVRCharacter;
+class FSavedMove_VRCharacter;
+
+#if !UE_BUILD_SHIPPING
+// Counters incremented by the VR character movement while a replay is running, read by the replay to report per move sweep counts
+namespace VRMovementReplayCounters
+{
+	extern VREXPANSIONPLUGIN_API bool bCounting;
+	extern VREXPANSIONPLUGIN_API uint32 FloorSweeps;
+	extern VREXPANSIONPLUGIN_API uint32 MoveSweeps;
+}
+
+// Movement only runs on the game thread, so the counters are left non atomic
+#define VR_MOVEMENT_REPLAY_COUNT(Counter) do { if (VRMovementReplayCounters::bCounting) { ++VRMovementReplayCounters::Counter; } } while (0)
+#else
+#define VR_MOVEMENT_REPLAY_COUNT(Counter) do { } while (0)
+#endif
+
+/**
+* A single client move as it was sent to the server, plus the tracked device poses at the time.
+*/
+struct VREXPANSIONPLUGIN_API FVRRecordedMove
+{
+	float TimeStamp;
+	float DeltaTime;
+	FVector Acceleration;
+	FVector ClientLocation;
+	FRotator ControlRotation;
+	uint8 CompressedFlags;
+	uint8 EndPackedMovementMode;
+
+	FVector VRCapsuleLocation;
+	FRotator VRCapsuleRotation;
+	FVector LFDiff;
+	FVector CustomVRInputVector;
+	FVector RequestedVelocity;
+	TArray<FVRMoveActionContainer> MoveActions;
+
+	FTransform HMDRelativeTransform;
+	FTransform LeftControllerRelativeTransform;
+	FTransform RightControllerRelativeTransform;
+
+	FVRRecordedMove();
+
+	friend FArchive& operator<<(FArchive& Ar, FVRRecordedMove& Move);
+};
+
+/**
+* A stream of recorded client moves, saved to disk as a small versioned binary file.
+*/
+struct VREXPANSIONPLUGIN_API FVRMovementRecording
+{
+	FVector StartLocation;
+	FRotator StartRotation;
+	FVector StartVelocity;
+	float CapsuleHalfHeight;
+	float CapsuleRadius;
+	TArray<FVRRecordedMove> Moves;
+
+	FVRMovementRecording();
+
+	// Starts a recording from the characters current state
+	void Begin(AVRCharacter * Character);
+
+	// Appends a move that is about to be sent to the server
+	void RecordMove(const FSavedMove_VRCharacter & Move, AVRCharacter * Character);
+
+	bool SaveToFile(const FString & FileName) const;
+	bool LoadFromFile(const FString & FileName);
+
+	// Relative file names are placed in Saved/VRMovement
+	static FString GetRecordingPath(const FString & FileName);
+
+	friend FArchive& operator<<(FArchive& Ar, FVRMovementRecording& Recording);
+};
+
+/**
+* Results of replaying a recording.
+*/
+struct VREXPANSIONPLUGIN_API FVRMovementReplayReport
+{
+	int32 NumMoves;
+	double TotalMoveMs;
+	double MaxMoveMs;
+	uint32 FloorSweeps;
+	uint32 MoveSweeps;
+	int32 Corrections;
+
+	// Moves that would have gone out to the server, lower than NumMoves when moves were combined
+	int32 ServerMoves;
+
+	FVRMovementReplayReport() :
+		NumMoves(0),
+		TotalMoveMs(0.0),
+		MaxMoveMs(0.0),
+		FloorSweeps(0),
+		MoveSweeps(0),
+		Corrections(0),
+		ServerMoves(0)
+	{}
+
+	FString ToString() const;
+};
+
+/**
+* Replays a recording against a character with authority, synchronously, in the current world.
+* The server path feeds each move through ServerMoveVR_Implementation the same way the RPC would (including quantization and error checks),
+* corrections are moves that the server would have sent an adjustment for.
+* The client path runs each move through PrepMoveFor / MoveAutonomous like a client replaying after an adjustment,
+* corrections are moves whose end location differs from the recorded one by more than the allowed position error.
+* OutSentMoves gets a copy of the recording with the client paths end locations, this captures scripted input or re-bases a recording after a movement change.
+* bCombineMoves combines consecutive client moves the same way ReplicateMoveToServer does with bAllowMovementMerging, OutSentMoves then holds the combined moves.
+*/
+class VREXPANSIONPLUGIN_API FVRMovementReplay
+{
+public:
+
+	static FVRMovementReplayReport Replay(AVRCharacter * Character, const FVRMovementRecording & Recording, bool bServerPath, FVRMovementRecording * OutSentMoves = nullptr, bool bCombineMoves = false);
+};
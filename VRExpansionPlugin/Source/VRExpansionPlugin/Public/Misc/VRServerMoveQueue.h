@@ -0,0 +1,104 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UVRCharacterMovementComponent;
+class UWorld;
+
+/**
+* A client move that arrived at the server and is waiting for budget to be simulated.
+*/
+struct FVRQueuedServerMove
+{
+	TFunction<void()> Execute;
+	double QueuedTime;
+
+	FVRQueuedServerMove() :
+		QueuedTime(0.0)
+	{}
+};
+
+/**
+* Per connection queue of deferred server moves, stored on the movement component.
+*/
+struct VREXPANSIONPLUGIN_API FVRServerMoveQueueState
+{
+	TArray<FVRQueuedServerMove> Moves;
+
+	// True while a move from this queue is running, moves submitted during it run directly
+	bool bExecuting;
+
+	// Totals since the last reset
+	int32 MaxDepth;
+	int32 NumProcessed;
+	int32 NumForced;
+	double TotalLatency;
+	double MaxLatency;
+
+	FVRServerMoveQueueState() :
+		bExecuting(false)
+	{
+		ResetStats();
+	}
+
+	void ResetStats()
+	{
+		MaxDepth = 0;
+		NumProcessed = 0;
+		NumForced = 0;
+		TotalLatency = 0.0;
+		MaxLatency = 0.0;
+	}
+};
+
+/**
+* Spreads the simulation of incoming VR client moves over frames when the server is over budget (vre.ServerMoveBudgetMs).
+* Moves run immediately while budget remains, once it is spent they are queued per character and run round robin on later ticks.
+* Moves older than vre.ServerMoveMaxQueueAge are always run so that no connection falls too far behind.
+*/
+class VREXPANSIONPLUGIN_API FVRServerMoveQueue
+{
+public:
+
+	static FVRServerMoveQueue & Get();
+
+	// True if a move budget is set
+	static bool IsEnabled();
+
+	// True if moves for this component go through the queue, only player controlled characters on a server do
+	static bool ShouldQueueMoves(const UVRCharacterMovementComponent * MoveComp);
+
+	// Runs the move now if nothing is waiting for this character and budget remains, otherwise queues it
+	void SubmitMove(UVRCharacterMovementComponent * MoveComp, TFunction<void()> && Move);
+
+	// Runs queued moves for the world within the remaining budget, or all of them if the budget was turned off. Only does work once per frame per world
+	void ProcessWorld(UWorld * World);
+
+	// Runs every move still queued for the character, in order
+	void DrainMoves(UVRCharacterMovementComponent * MoveComp);
+
+	// Logs per connection queue depth and latency for the world
+	void DumpStats(UWorld * World, bool bReset);
+
+private:
+
+	FVRServerMoveQueue();
+
+	void BeginFrameBudget();
+	bool HasBudgetLeft() const;
+	void ExecuteMove(UVRCharacterMovementComponent * MoveComp, TFunction<void()> & Move, double QueuedTime, bool bForced);
+	void ExecuteFrontMove(UVRCharacterMovementComponent * MoveComp, bool bForced);
+	void RunExpiredMoves(UVRCharacterMovementComponent * MoveComp, double CurrentTime);
+
+	TArray<TWeakObjectPtr<UVRCharacterMovementComponent>> QueuedComponents;
+	int32 RoundRobinIndex;
+
+	uint64 BudgetFrame;
+	double BudgetSpent;
+
+	TMap<FObjectKey, uint64> LastProcessedFrame;
+};
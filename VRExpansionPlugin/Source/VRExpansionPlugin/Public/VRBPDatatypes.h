@@ -5,6 +5,7 @@
 //#include "EngineMinimal.h"
 
 #include "PhysicsPublic.h"
+#include "Engine/NetSerialization.h"
 #if WITH_PHYSX
 #include "PhysXPublic.h"
 #include "PhysXSupport.h"
@@ -1092,8 +1093,10 @@ public:
 
 #define INVALID_VRGRIP_ID 0
 
+struct FBPActorGripArray;
+
 USTRUCT(BlueprintType, Category = "VRExpansionLibrary")
-struct VREXPANSIONPLUGIN_API FBPActorGripInformation
+struct VREXPANSIONPLUGIN_API FBPActorGripInformation : public FFastArraySerializerItem
 {
 	GENERATED_BODY()
 public:
@@ -1312,8 +1315,89 @@ public:
 	{
 	}	
 
+	// Per grip delta replication callbacks, see FBPActorGripArray
+	void PreReplicatedRemove(const FBPActorGripArray & InArraySerializer);
+	void PostReplicatedAdd(const FBPActorGripArray & InArraySerializer);
+	void PostReplicatedChange(const FBPActorGripArray & InArraySerializer);
 };
 
+/**
+* Delta replicated grip array, only grips that were marked dirty are sent instead of diffing the whole array.
+* Clients collect the IDs of added and changed grips here and the owning controller handles just those in its OnRep.
+* Anything that changes a replicated value of a grip on the server has to mark it dirty (UGripMotionControllerComponent::MarkGripDirty).
+*/
+USTRUCT(BlueprintType, Category = "VRExpansionLibrary")
+struct VREXPANSIONPLUGIN_API FBPActorGripArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+public:
+
+	UPROPERTY(BlueprintReadOnly, Category = "Settings")
+		TArray<FBPActorGripInformation> Grips;
+
+	// Grips added or changed by replication since the last OnRep, the item callbacks only get a const array
+	mutable TArray<uint8> PendingRepGripIDs;
+
+	// Replication added or removed grips since the last OnRep, slots may have moved
+	mutable bool bPendingRepLayoutChange = false;
+
+	FORCEINLINE int32 AddGrip(const FBPActorGripInformation & Grip)
+	{
+		int32 Index = Grips.Add(Grip);
+		MarkItemDirty(Grips[Index]);
+		return Index;
+	}
+
+	FORCEINLINE void RemoveGripAt(int32 Index)
+	{
+		Grips.RemoveAt(Index);
+		MarkArrayDirty();
+	}
+
+	FORCEINLINE void EmptyGrips()
+	{
+		Grips.Empty();
+		MarkArrayDirty();
+	}
+
+	// True if the grip is stored in this array
+	FORCEINLINE bool OwnsGrip(const FBPActorGripInformation & Grip) const
+	{
+		return Grips.Num() && &Grip >= Grips.GetData() && &Grip < Grips.GetData() + Grips.Num();
+	}
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo & DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FBPActorGripInformation, FBPActorGripArray>(Grips, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits< FBPActorGripArray > : public TStructOpsTypeTraitsBase2<FBPActorGripArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
+
+FORCEINLINE void FBPActorGripInformation::PreReplicatedRemove(const FBPActorGripArray & InArraySerializer)
+{
+	InArraySerializer.PendingRepGripIDs.Remove(GripID);
+	InArraySerializer.bPendingRepLayoutChange = true;
+}
+
+FORCEINLINE void FBPActorGripInformation::PostReplicatedAdd(const FBPActorGripArray & InArraySerializer)
+{
+	InArraySerializer.PendingRepGripIDs.AddUnique(GripID);
+	InArraySerializer.bPendingRepLayoutChange = true;
+}
+
+FORCEINLINE void FBPActorGripInformation::PostReplicatedChange(const FBPActorGripArray & InArraySerializer)
+{
+	InArraySerializer.PendingRepGripIDs.AddUnique(GripID);
+}
+
 USTRUCT(BlueprintType, Category = "VRExpansionLibrary")
 struct VREXPANSIONPLUGIN_API FBPInterfaceProperties
 {
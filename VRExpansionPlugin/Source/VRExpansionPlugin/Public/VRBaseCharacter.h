@@ -46,6 +46,9 @@ public:
 	bool bOriginalControlRotation;
 	bool bWasOverLimit;
 
+	// Scaler that OnSeatThreshholdChanged was last fired with
+	float LastBroadcastScaler;
+
 	FVRSeatedCharacterInfo()
 	{
 		Clear();
@@ -62,6 +65,8 @@ public:
 		AllowedRadius = 40.0f;
 		AllowedRadiusThreshold = 20.0f;
 		CurrentThresholdScaler = 0.0f;
+		LastBroadcastScaler = 0.0f;
+		bIsOverThreshold = false;
 	}
 
 	void ClearTempVals()
@@ -70,6 +75,36 @@ public:
 		bWasSeated = false;
 		bOriginalControlRotation = false;
 		CurrentThresholdScaler = 0.0f;
+		LastBroadcastScaler = 0.0f;
+		bIsOverThreshold = false;
+	}
+
+	// Updates the threshold state for the heads distance from the seat, returns true if OnSeatThreshholdChanged should fire
+	bool UpdateThreshold(float HeadDistance, float Hysteresis, float ScalerStep)
+	{
+		const bool bLastOverThreshold = bIsOverThreshold;
+		const float ThresholdStart = AllowedRadius - AllowedRadiusThreshold;
+
+		// Hysteresis so that a head resting on the edge of the threshold doesn't flip the state every frame
+		if (bIsOverThreshold)
+			bIsOverThreshold = HeadDistance > ThresholdStart - Hysteresis;
+		else
+			bIsOverThreshold = HeadDistance > ThresholdStart;
+
+		CurrentThresholdScaler = FMath::Clamp((HeadDistance - ThresholdStart) / AllowedRadiusThreshold, 0.0f, 1.0f);
+
+		// Coalesce small head motion into steps of the scaler, the ends always fire so that effects fully fade in and out
+		const float ScalerChange = FMath::Abs(CurrentThresholdScaler - LastBroadcastScaler);
+		const bool bScalerAtEnd = CurrentThresholdScaler == 0.0f || CurrentThresholdScaler == 1.0f;
+		const bool bScalerChanged = ScalerChange > KINDA_SMALL_NUMBER && (bScalerAtEnd || ScalerChange >= ScalerStep);
+
+		if (bLastOverThreshold != bIsOverThreshold || bScalerChanged)
+		{
+			LastBroadcastScaler = CurrentThresholdScaler;
+			return true;
+		}
+
+		return false;
 	}
 
 
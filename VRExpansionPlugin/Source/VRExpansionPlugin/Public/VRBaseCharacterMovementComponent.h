@@ -175,12 +175,14 @@ struct VREXPANSIONPLUGIN_API FVRMoveActionArray
 {
 	GENERATED_USTRUCT_BODY()
 public:
-	UPROPERTY()
-		TArray<FVRMoveActionContainer> MoveActions;
+	// Not a UPROPERTY, it holds no object references and is only ever sent through NetSerialize.
+	// Inline storage so that saved moves don't allocate for the usual zero to two actions per move.
+	TArray<FVRMoveActionContainer, TInlineAllocator<2>> MoveActions;
 
+	// Keeps the storage around, saved moves are recycled
 	void Clear()
 	{
-		MoveActions.Empty();
+		MoveActions.Reset();
 	}
 	/** Network serialization */
 	// Doing a custom NetSerialize here because this is sent via RPCs and should change on every update
@@ -403,6 +405,96 @@ struct TStructOpsTypeTraits< FVRConditionalMoveRep2 > : public TStructOpsTypeTra
 	};
 };
 
+UENUM()
+enum class EVRCompactAdjustmentVelocity : uint8
+{
+	// Velocity is zero
+	Zero,
+	// Velocity is sent along with its id
+	Sent,
+	// Velocity matches the last sent one with the same id
+	Unchanged
+};
+
+/**
+* Client correction sent relative to the location that the client reported for the corrected move.
+* Only used when the server and client agree on the movement base, so the base and bone name are left out.
+*/
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FVRCompactClientAdjustment
+{
+	GENERATED_USTRUCT_BODY()
+public:
+
+	// Corrected location minus the location the client sent with the move, relative to the base if the base uses relative locations
+	UPROPERTY(Transient)
+	FVector LocationDelta;
+
+	UPROPERTY(Transient)
+	uint16 Yaw;
+
+	// If false the server has no movement base, otherwise the client uses the base from its own move
+	UPROPERTY(Transient)
+	bool bHasBase;
+
+	UPROPERTY(Transient)
+	EVRCompactAdjustmentVelocity VelocityMode;
+
+	UPROPERTY(Transient)
+	uint8 VelocityId;
+
+	UPROPERTY(Transient)
+	FVector Velocity;
+
+	FVRCompactClientAdjustment()
+	{
+		LocationDelta = FVector::ZeroVector;
+		Yaw = 0;
+		bHasBase = false;
+		VelocityMode = EVRCompactAdjustmentVelocity::Zero;
+		VelocityId = 0;
+		Velocity = FVector::ZeroVector;
+	}
+
+	/** Network serialization */
+	// Small deltas pack down to a few bits per axis, the velocity is only sent when it changed
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		bOutSuccess = true;
+
+		// Same precision as the FVector_NetQuantize100 client location it is applied to
+		bOutSuccess &= SerializePackedVector<100, 30>(LocationDelta, Ar);
+		Ar << Yaw;
+		Ar.SerializeBits(&bHasBase, 1);
+
+		uint8 VelocityModeByte = (uint8)VelocityMode;
+		Ar.SerializeBits(&VelocityModeByte, 2);
+		VelocityMode = (EVRCompactAdjustmentVelocity)VelocityModeByte;
+
+		if (VelocityMode == EVRCompactAdjustmentVelocity::Sent)
+		{
+			bOutSuccess &= SerializePackedVector<10, 24>(Velocity, Ar);
+			Ar << VelocityId;
+		}
+		else if (VelocityMode == EVRCompactAdjustmentVelocity::Unchanged)
+		{
+			Ar << VelocityId;
+		}
+
+		return bOutSuccess;
+	}
+
+};
+
+template<>
+struct TStructOpsTypeTraits< FVRCompactClientAdjustment > : public TStructOpsTypeTraitsBase2<FVRCompactClientAdjustment>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
 /**
 * Helper to change mesh bone updates within a scope.
 * Example usage:
@@ -487,32 +579,7 @@ public:
 		return Result;
 	}
 
-	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* Character, float MaxDelta) const override
-	{
-		FSavedMove_VRBaseCharacter * nMove = (FSavedMove_VRBaseCharacter *)NewMove.Get();
-
-
-		if (!nMove || (VRReplicatedMovementMode != nMove->VRReplicatedMovementMode))
-			return false;
-
-		if (ConditionalValues.MoveActionArray.MoveActions.Num() > 0 || nMove->ConditionalValues.MoveActionArray.MoveActions.Num() > 0)
-			return false;
-
-		if (!ConditionalValues.CustomVRInputVector.IsZero() || !nMove->ConditionalValues.CustomVRInputVector.IsZero())
-			return false;
-
-		if (!ConditionalValues.RequestedVelocity.IsZero() || !nMove->ConditionalValues.RequestedVelocity.IsZero())
-			return false;
-
-		// Hate this but we really can't combine if I am sending a new capsule height
-		if (!FMath::IsNearlyEqual(LFDiff.Z, nMove->LFDiff.Z))
-			return false;
-
-		if (!LFDiff.IsZero() && !nMove->LFDiff.IsZero() && !FVector::Coincident(LFDiff.GetSafeNormal2D(), nMove->LFDiff.GetSafeNormal2D(), AccelDotThresholdCombine))
-			return false;
-
-		return FSavedMove_Character::CanCombineWith(NewMove, Character, MaxDelta);
-	}
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* Character, float MaxDelta) const override;
 
 
 	virtual bool IsImportantMove(const FSavedMovePtr& LastAckedMove) const override
@@ -573,6 +640,41 @@ public:
 	// Overriding this to run the seated logic
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 
+	// If true, locally controlled characters and simulated proxies that have been stationary for vre.RestingEnterFrames frames
+	// only run their movement tick every vre.RestingTickInterval frames, until input, velocity, HMD movement, base movement or a correction wakes them.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement")
+	bool bAllowRestingState;
+
+	// True while the movement tick is being decimated for a stationary character
+	UFUNCTION(BlueprintPure, Category = "VRMovement")
+	bool IsResting() const
+	{
+		return bIsResting;
+	}
+
+	// Leaves the resting state, the next tick runs full movement
+	UFUNCTION(BlueprintCallable, Category = "VRMovement")
+	void WakeFromRest();
+
+protected:
+
+	bool bIsResting;
+	int32 RestingCandidateFrames;
+	int32 RestingSkippedFrames;
+	float RestingSkippedTime;
+	FVector RestingSkippedVRInput;
+	FVector RestingBaseLocation;
+	FQuat RestingBaseRotation;
+
+	// True if nothing is moving or about to move the character this frame
+	bool CanRest();
+
+	// Updates the resting state, returns true if this frames movement tick should be skipped.
+	// When a tick runs after skipped frames DeltaTime is increased by the skipped time.
+	bool UpdateRestingState(float & DeltaTime);
+
+public:
+
 	// Called when a valid climbing step up movement is found, if bound to the default auto step up is not performed to let custom step up logic happen instead.
 	UPROPERTY(BlueprintAssignable, Category = "VRMovement")
 		FVROnPerformClimbingStepUp OnPerformClimbingStepUp;
@@ -17,6 +17,7 @@
 #include "WorldCollision.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "VRBaseCharacterMovementComponent.h"
+#include "Misc/VRServerMoveQueue.h"
 #include "VRCharacterMovementComponent.generated.h"
 
 class FDebugDisplayInfo;
@@ -25,6 +26,28 @@ class AVRCharacter;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogVRCharacterMovement, Log, All);
 
+/**
+* Last floor sweep result over a flat static floor.
+* Re-used while the capsule only drifts slightly from where the sweep was done (room scale HMD movement).
+*/
+struct FVRCachedFloorResult
+{
+	FFindFloorResult FloorResult;
+	FVector CapsuleLocation;
+	float CapsuleRadius;
+	float CapsuleHalfHeight;
+	float CacheTime;
+	bool bIsValid;
+
+	FVRCachedFloorResult() :
+		CapsuleLocation(FVector::ZeroVector),
+		CapsuleRadius(0.0f),
+		CapsuleHalfHeight(0.0f),
+		CacheTime(0.0f),
+		bIsValid(false)
+	{}
+};
+
 /** Shared pointer for easy memory management of FSavedMove_Character, for accumulating and replaying network moves. */
 //typedef TSharedPtr<class FSavedMove_Character> FSavedMovePtr;
 
@@ -51,9 +74,21 @@ class VREXPANSIONPLUGIN_API UVRCharacterMovementComponent : public UVRBaseCharac
 	GENERATED_BODY()
 public:
 
+	friend class FVRMovementReplay;
+
 	UPROPERTY(BlueprintReadOnly, Transient, Category = VRMovement)
 	UVRRootComponent * VRRootCapsule;
 
+	// When valid every move sent to the server is also appended here (vr.MovementRecordStart / vr.MovementRecordStop)
+	TSharedPtr<struct FVRMovementRecording> ActiveMovementRecording;
+
+	// Server side moves from this characters connection that are waiting on the move budget (vre.ServerMoveBudgetMs)
+	FVRServerMoveQueueState ServerMoveQueueState;
+
+	// Server only, current and max number of queued moves for this connection and how long they waited before being simulated
+	UFUNCTION(BlueprintCallable, Category = "VRCharacterMovementComponent")
+	void GetServerMoveQueueStats(int32 & QueueDepth, int32 & MaxQueueDepth, float & AverageLatencyMs, float & MaxLatencyMs) const;
+
 	/** Reject sweep impacts that are this close to the edge of the vertical portion of the capsule when performing vertical sweeps, and try again with a smaller capsule. */
 	static const float CLIMB_SWEEP_EDGE_REJECT_DISTANCE;
 	virtual bool IsWithinClimbingEdgeTolerance(const FVector& CapsuleLocation, const FVector& TestImpactPoint, const float CapsuleRadius) const;
@@ -65,7 +100,8 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent")
 		bool bUseClientControlRotation;
 
-	// Allow merging movement replication (may cause issues when >10 players due to capsule location
+	// Allow combining consecutive client moves in to a single server move, HMD offsets and movement mode changes are carried over to the combined move
+	// Off by default until the VRExpansionPlugin.MovementMerging automation test has been run and passes
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent")
 	bool bAllowMovementMerging;
 
@@ -154,6 +190,29 @@ public:
 	virtual void ClientVeryShortAdjustPositionVR(float TimeStamp, FVector NewLoc, uint16 NewYaw, UPrimitiveComponent* NewBase, FName NewBaseBoneName, bool bHasBase, bool bBaseRelativePosition, uint8 ServerMovementMode);
 	virtual void ClientVeryShortAdjustPositionVR_Implementation(float TimeStamp, FVector NewLoc, uint16 NewYaw, UPrimitiveComponent* NewBase, FName NewBaseBoneName, bool bHasBase, bool bBaseRelativePosition, uint8 ServerMovementMode);
 
+	/* Bandwidth saving version, location is a delta from the location the client sent for the move (vre.CompactClientAdjustments) */
+	virtual void ClientCompactAdjustPositionVR(float TimeStamp, const FVRCompactClientAdjustment & Adjustment, uint8 ServerMovementMode);
+	virtual void ClientCompactAdjustPositionVR_Implementation(float TimeStamp, const FVRCompactClientAdjustment & Adjustment, uint8 ServerMovementMode);
+
+protected:
+
+	// Fills out a compact adjustment for the pending correction, returns false if the full correction needs to be sent instead
+	bool BuildCompactClientAdjustment(const FNetworkPredictionData_Server_Character & ServerData, FVRCompactClientAdjustment & OutAdjustment);
+
+	// True if the last correction was sent less than a round trip ago, moves arriving now were made before the client received it
+	bool IsClientAdjustmentInFlight(float CurrentTime) const;
+
+	// Location, base and bone that the client sent with the move that the pending correction is for
+	FVector PendingAdjustmentClientLocation;
+	UPrimitiveComponent * PendingAdjustmentClientBase;
+	FName PendingAdjustmentClientBoneName;
+
+	// Last velocity sent in a compact adjustment, the client keeps its own copy so that unchanged velocities can be left out
+	FVector LastCompactAdjustmentVelocity;
+	uint8 LastCompactAdjustmentVelocityId;
+
+public:
+
 
 
 	///////////////////////////
@@ -181,6 +240,9 @@ public:
 	virtual void ServerMoveVR(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 CompressedMoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode);
 	virtual void ServerMoveVR_Implementation(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 CompressedMoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode);
 	virtual bool ServerMoveVR_Validate(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 CompressedMoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode);
+
+	// Goes through the server move queue as well so that it stays in order with the queued moves
+	virtual void ServerMoveOld_Implementation(float OldTimeStamp, FVector_NetQuantize10 OldAccel, uint8 OldMoveFlags) override;
 	
 	/** Replicated function sent by client to server - contains client movement and view info. ExLight version is used if there was no requested velocity or customVRInputVector or Accell*/
 	//UFUNCTION(unreliable, server, WithValidation)
@@ -265,6 +327,24 @@ public:
 	// Had to force it within the function to use VRLocation instead.
 	virtual void FindFloor(const FVector& CapsuleLocation, FFindFloorResult& OutFloorResult, bool bZeroDelta, const FHitResult* DownwardSweepResult) const override;
 
+	// Forces the next FindFloor to sweep instead of re-using the cached floor (vre.FloorCache)
+	void InvalidateFloorCache() const
+	{
+		CachedFloor.bIsValid = false;
+	}
+
+protected:
+
+	mutable FVRCachedFloorResult CachedFloor;
+
+	// Returns true and fills the floor result if the cached floor is still valid at this capsule location
+	bool GetCachedFloor(const FVector& CapsuleLocation, FFindFloorResult& OutFloorResult) const;
+
+	// Caches the floor result if it is on a flat static floor that the capsule isn't near the edge of
+	void UpdateFloorCache(const FVector& CapsuleLocation, const FFindFloorResult& FloorResult) const;
+
+public:
+
 	// Need to use actual capsule location for step up
 	bool StepUp(const FVector& GravDir, const FVector& Delta, const FHitResult &InHit, FStepDownResult* OutStepDownResult = NULL) override;
 
@@ -372,15 +452,13 @@ public:
 class VREXPANSIONPLUGIN_API FNetworkPredictionData_Client_VRCharacter : public FNetworkPredictionData_Client_Character
 {
 public:
-	FNetworkPredictionData_Client_VRCharacter(const UCharacterMovementComponent& ClientMovement)
-		: FNetworkPredictionData_Client_Character(ClientMovement)
-	{
-
-	}
+	// Fills the free move pool up front (vre.SavedMovePoolPrewarm) so that saved moves are recycled from the start
+	FNetworkPredictionData_Client_VRCharacter(const UCharacterMovementComponent& ClientMovement);
 
 	FSavedMovePtr AllocateNewMove()
 	{
-		return FSavedMovePtr(new FSavedMove_VRCharacter());
+		// Object and reference count in one allocation
+		return MakeShared<FSavedMove_VRCharacter>();
 	}
 };
 
@@ -397,6 +475,6 @@ public:
 
 	FSavedMovePtr AllocateNewMove()
 	{
-		return FSavedMovePtr(new FSavedMove_VRCharacter());
+		return MakeShared<FSavedMove_VRCharacter>();
 	}
 };
\ No newline at end of file
@@ -159,6 +159,7 @@ public:
 	static bool GetIsActorMovable(AActor * ActorToCheck);
 
 	// Gets if an actors root component contains a grip slot within range
+	// Slots are cached per mesh asset and slot type, so repeated queries don't search the socket names again
 	UFUNCTION(BlueprintPure, Category = "VRGrip", meta = (bIgnoreSelf = "true", DisplayName = "GetGripSlotInRangeByTypeName"))
 	static void GetGripSlotInRangeByTypeName(FName SlotType, AActor * Actor, FVector WorldLocation, float MaxRange, bool & bHadSlotInRange, FTransform & SlotWorldTransform);
 
@@ -134,6 +134,22 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "Secondary Grip 1Euro Settings")
 	float OneEuroDeltaCutoff;
 
+	// If true, dedicated servers skip the client only VR paths (late update view extensions, render thread transform caching,
+	// debug drawing, log capture, gesture drawing and smoothing of replicated controller motion while it has no physics grips).
+	// Server only builds (UE_SERVER) always skip them regardless of this setting.
+	UPROPERTY(config, EditAnywhere, Category = "Server Settings")
+	bool bUseDedicatedServerOptimizations;
+
+	// Returns true if this instance should skip the client only VR paths
+	static bool IsServerOptimized()
+	{
+#if UE_SERVER
+		return true;
+#else
+		return IsRunningDedicatedServer() && GetDefault<UVRGlobalSettings>()->bUseDedicatedServerOptimizations;
+#endif
+	}
+
 	// Adjust the transform of a socket for a particular controller model, if a name is not sent in, it will use the currently loaded one
 	// If there is no currently loaded one, it will return the input transform as is.
 	// If bIsRightHand and the target profile uses seperate hand transforms it will use the right hand transform
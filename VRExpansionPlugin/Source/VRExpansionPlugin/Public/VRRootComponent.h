@@ -66,14 +66,32 @@ public:
 	inline void OnUpdateTransform_Public(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport = ETeleportType::None)
 	{
 		OnUpdateTransform(UpdateTransformFlags, Teleport);
-		if (bNavigationRelevant && bRegistered)
-		{
-			UpdateNavigationData();
-			PostUpdateNavigationData();
-		}
+		bNavigationUpdatePending = true;
+		UpdateNavigationDataThrottled();
 	}
 
+	// Navigation data is only updated once the capsule has moved this far from where it was last updated (0 updates on any movement).
+	// Keeps head motion from constantly re-registering the pawn in the navigation octree.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary|Navigation", meta = (ClampMin = "0.0", UIMin = "0.0"))
+	float NavigationUpdateMinDistance;
+
+	// Minimum seconds between navigation data updates (0 is no limit)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary|Navigation", meta = (ClampMin = "0.0", UIMin = "0.0"))
+	float NavigationUpdateMinInterval;
+
+	// Updates the navigation data now, regardless of the limits above or whether the capsule has moved
+	UFUNCTION(BlueprintCallable, Category = "VRExpansionLibrary|Navigation")
+	void ForceNavigationUpdate();
+
 protected:
+
+	bool bNavigationUpdatePending;
+	FVector LastNavigationUpdateLocation;
+	float LastNavigationUpdateTime;
+
+	// Runs a pending navigation update if the distance and interval limits allow it
+	void UpdateNavigationDataThrottled(bool bForce = false);
+
 	virtual bool MoveComponentImpl(const FVector& Delta, const FQuat& NewRotation, bool bSweep, FHitResult* OutHit = NULL, EMoveComponentFlags MoveFlags = MOVECOMP_NoFlags, ETeleportType Teleport = ETeleportType::None) override;
 	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport = ETeleportType::None) override;
 
@@ -129,6 +147,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary")
 	TEnumAsByte<ECollisionChannel> WalkingCollisionOverride;
 
+	// When above zero, HMD movement is accumulated and the walking collision override sweep is only run once it adds up to this distance.
+	// The sweep then covers all of the accumulated movement, this saves a scene query on most frames for a standing player.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary", meta = (ClampMin = "0.0", UIMin = "0.0", EditCondition = "bUseWalkingCollisionOverride"))
+	float WalkingCollisionMinSweepDistance;
+
+	// HMD movement that hasn't been swept for the walking collision override yet
+	FVector PendingRelativeMovement;
+
 	/*ECollisionChannel GetVRCollisionObjectType()
 	{
 		if (bUseWalkingCollisionOverride)